@@ -0,0 +1,204 @@
+#ifndef CONSTEXPR_LIST_ARENA
+#define CONSTEXPR_LIST_ARENA
+
+#include <cstdint>
+#include <limits>
+#include <new>
+
+#include "constexpr_list.hpp"
+
+namespace constexpr_list
+{
+	struct heap_block_source
+	{
+		static constexpr std::size_t default_block_size = std::size_t{ 1 } << 16;
+		static constexpr std::size_t max_block_size = std::size_t{ 1 } << 26;
+
+		static void* allocate(std::size_t& size)
+		{
+			return ::operator new(size);
+		}
+
+		static void deallocate(void* block, std::size_t size) noexcept
+		{
+			::operator delete(block, size);
+		}
+	};
+
+	template <typename BlockSource>
+	class basic_arena
+	{
+	public:
+		using block_source = BlockSource;
+
+		static constexpr std::size_t default_block_size = BlockSource::default_block_size;
+		static constexpr std::size_t max_block_size = BlockSource::max_block_size;
+
+		constexpr basic_arena() noexcept = default;
+
+		explicit constexpr basic_arena(std::size_t block_size) noexcept
+			: next_block_size_{ std::clamp(block_size, sizeof(block_) * 2, max_block_size) }
+		{}
+
+		basic_arena(const basic_arena&) = delete;
+		basic_arena& operator=(const basic_arena&) = delete;
+
+		constexpr ~basic_arena()
+		{
+			this->release();
+		}
+
+		void* allocate(std::size_t bytes, std::size_t alignment)
+		{
+			std::uintptr_t aligned = (cursor_ + alignment - 1) & ~(alignment - 1);
+
+			if (aligned < cursor_ || aligned > limit_ || bytes > limit_ - aligned)
+			{
+				if (bytes > std::numeric_limits<std::size_t>::max() - alignment - sizeof(block_))
+				{
+					throw std::bad_alloc{};
+				}
+
+				this->grow_(bytes + alignment);
+				aligned = (cursor_ + alignment - 1) & ~(alignment - 1);
+			}
+
+			cursor_ = aligned + bytes;
+			return reinterpret_cast<void*>(aligned);
+		}
+
+		void deallocate(void* ptr, std::size_t bytes) noexcept
+		{
+			if (reinterpret_cast<std::uintptr_t>(ptr) + bytes == cursor_)
+			{
+				cursor_ = reinterpret_cast<std::uintptr_t>(ptr);
+			}
+		}
+
+		constexpr void release() noexcept
+		{
+			if !consteval
+			{
+				while (head_)
+				{
+					block_* next = head_->next_;
+					BlockSource::deallocate(static_cast<void*>(head_), head_->size_);
+					head_ = next;
+				}
+
+				cursor_ = 0;
+				limit_ = 0;
+				blocks_ = 0;
+				reserved_ = 0;
+			}
+		}
+
+		[[nodiscard]]
+		constexpr std::size_t blocks() const noexcept
+		{
+			return blocks_;
+		}
+
+		[[nodiscard]]
+		constexpr std::size_t bytes_reserved() const noexcept
+		{
+			return reserved_;
+		}
+
+	private:
+		struct block_
+		{
+			block_* next_;
+			std::size_t size_;
+		};
+
+		void grow_(std::size_t bytes)
+		{
+			std::size_t size = std::max(next_block_size_, bytes + sizeof(block_));
+			void* memory = BlockSource::allocate(size);
+			head_ = ::new (memory) block_{ head_, size };
+			cursor_ = reinterpret_cast<std::uintptr_t>(head_ + 1);
+			limit_ = reinterpret_cast<std::uintptr_t>(head_) + size;
+			next_block_size_ = std::min(next_block_size_ * 2, max_block_size);
+			reserved_ += size;
+			++blocks_;
+		}
+
+		block_* head_ = nullptr;
+		std::uintptr_t cursor_ = 0;
+		std::uintptr_t limit_ = 0;
+		std::size_t next_block_size_ = default_block_size;
+		std::size_t blocks_ = 0;
+		std::size_t reserved_ = 0;
+	};
+
+	using arena = basic_arena<heap_block_source>;
+
+	template <typename T, typename Arena = arena>
+	class arena_allocator
+	{
+		template <typename U, typename A>
+		friend class arena_allocator;
+
+	public:
+		using value_type = T;
+		using is_always_equal = std::false_type;
+		using skips_deallocation = std::true_type;
+
+		using arena_type = Arena;
+
+		constexpr arena_allocator(Arena& a) noexcept
+			: arena_{ std::addressof(a) }
+		{}
+
+		template <typename U>
+		constexpr arena_allocator(const arena_allocator<U, Arena>& other) noexcept
+			: arena_{ other.arena_ }
+		{}
+
+		constexpr T* allocate(std::size_t n)
+		{
+			if consteval
+			{
+				return std::allocator<T>{}.allocate(n);
+			}
+			else
+			{
+				if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+				{
+					throw std::bad_array_new_length{};
+				}
+
+				return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+			}
+		}
+
+		constexpr void deallocate(T* ptr, std::size_t n) noexcept
+		{
+			if consteval
+			{
+				std::allocator<T>{}.deallocate(ptr, n);
+			}
+			else
+			{
+				arena_->deallocate(ptr, n * sizeof(T));
+			}
+		}
+
+		constexpr Arena& resource() const noexcept
+		{
+			return *arena_;
+		}
+
+		template <typename U>
+		friend constexpr bool operator==(const arena_allocator& lhs, const arena_allocator<U, Arena>& rhs) noexcept
+		{
+			return lhs.arena_ == rhs.arena_;
+		}
+
+	private:
+		Arena* arena_;
+	};
+}
+
+#endif // CONSTEXPR_LIST_ARENA
@@ -0,0 +1,116 @@
+#ifndef CONSTEXPR_LIST_BACKGROUND_RECLAIMER
+#define CONSTEXPR_LIST_BACKGROUND_RECLAIMER
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+#include "constexpr_list.hpp"
+
+namespace constexpr_list
+{
+	class background_reclaimer
+	{
+	public:
+		explicit background_reclaimer(std::size_t batch = 4096)
+			: batch_{ std::max<std::size_t>(batch, 1) }
+			, worker_([this](std::stop_token stop) { this->work_(stop); })
+		{}
+
+		background_reclaimer(const background_reclaimer&) = delete;
+		background_reclaimer& operator=(const background_reclaimer&) = delete;
+
+		~background_reclaimer()
+		{
+			this->wait_idle();
+		}
+
+		template <std::move_constructible Reclaimer>
+			requires requires (Reclaimer& r, std::size_t budget) { { r.reclaim(budget) } -> std::convertible_to<std::size_t>; r.empty(); }
+		void submit(Reclaimer reclaimer)
+		{
+			if (reclaimer.empty())
+			{
+				return;
+			}
+
+			{
+				std::scoped_lock lock{ mutex_ };
+				jobs_.emplace_back([r = std::move(reclaimer)](std::size_t budget) mutable
+				{
+					r.reclaim(budget);
+					return r.empty();
+				});
+			}
+
+			work_cv_.notify_one();
+		}
+
+		void wait_idle()
+		{
+			std::unique_lock lock{ mutex_ };
+			idle_cv_.wait(lock, [this] { return jobs_.empty() && !busy_; });
+		}
+
+		[[nodiscard]]
+		std::size_t pending() const
+		{
+			std::scoped_lock lock{ mutex_ };
+			return jobs_.size() + (busy_ ? 1 : 0);
+		}
+
+	private:
+		using job = std::move_only_function<bool(std::size_t)>;
+
+		void work_(std::stop_token stop)
+		{
+			while (true)
+			{
+				job current;
+				{
+					std::unique_lock lock{ mutex_ };
+					work_cv_.wait(lock, stop, [this] { return !jobs_.empty(); });
+
+					if (jobs_.empty())
+					{
+						return;
+					}
+
+					current = std::move(jobs_.front());
+					jobs_.pop_front();
+					busy_ = true;
+				}
+
+				const bool done = current(batch_);
+				{
+					std::scoped_lock lock{ mutex_ };
+
+					if (!done)
+					{
+						jobs_.push_back(std::move(current));
+					}
+
+					busy_ = false;
+
+					if (jobs_.empty())
+					{
+						idle_cv_.notify_all();
+					}
+				}
+			}
+		}
+
+		const std::size_t batch_;
+		mutable std::mutex mutex_;
+		std::condition_variable_any work_cv_;
+		std::condition_variable idle_cv_;
+		std::deque<job> jobs_;
+		bool busy_ = false;
+		std::jthread worker_;
+	};
+}
+
+#endif // CONSTEXPR_LIST_BACKGROUND_RECLAIMER
@@ -0,0 +1,58 @@
+#include <chrono>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <print>
+
+#include "../arena.hpp"
+
+namespace
+{
+	constexpr std::size_t elements = 10'000'000;
+
+	template <typename F>
+	double measure_ms(F f)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		f();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	template <typename List, typename ... Args>
+	void run(const char* name, Args&& ... args)
+	{
+		std::optional<List> values;
+
+		const double build = measure_ms([&]
+		{
+			values.emplace(std::forward<Args>(args)...);
+
+			for (std::size_t i = 0; i < elements; ++i)
+			{
+				values->push_back(i);
+			}
+		});
+
+		const double drop = measure_ms([&] { values.reset(); });
+
+		std::println("{:<28} build {:9.2f} ms   destroy {:9.3f} ms", name, build, drop);
+	}
+}
+
+int main()
+{
+	run<constexpr_list::list<std::uint64_t>>("std::allocator");
+
+	{
+		std::pmr::monotonic_buffer_resource resource;
+		run<constexpr_list::pmr::list<std::uint64_t>>("pmr monotonic_buffer", &resource);
+		std::println("{:<28} release {:9.3f} ms", "", measure_ms([&] { resource.release(); }));
+	}
+
+	{
+		constexpr_list::arena arena;
+		run<constexpr_list::list<std::uint64_t, constexpr_list::arena_allocator<std::uint64_t>>>("arena_allocator", arena);
+		const std::size_t blocks = arena.blocks();
+		std::println("{:<28} release {:9.3f} ms ({} blocks)", "", measure_ms([&] { arena.release(); }), blocks);
+	}
+}
@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <print>
+#include <random>
+
+#include "../constexpr_list.hpp"
+
+namespace
+{
+	template <typename F>
+	void report(const char* name, std::size_t elements, F run)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const std::size_t result = run();
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		std::println("{:<32} {:8.2f} Melem/s  (result {})",
+			name, static_cast<double>(elements) / elapsed.count() / 1e6, result);
+	}
+
+	template <typename T>
+	void run(const char* type)
+	{
+		constexpr std::size_t elements = 10'000'000;
+
+		std::mt19937_64 rng{ 7 };
+		constexpr_list::list<T> values;
+
+		for (std::size_t i = 0; i < elements; ++i)
+		{
+			values.push_back(static_cast<T>(rng() % 100));
+		}
+
+		const constexpr_list::list<T> copy = values;
+		const T needle = static_cast<T>(42);
+		const T missing = static_cast<T>(1000);
+
+		std::println("{}", type);
+		report("  std::ranges::count", elements, [&] { return std::ranges::count(values, needle); });
+		report("  list::count", elements, [&] { return values.count(needle); });
+		report("  std::ranges::find (miss)", elements,
+			[&] { return static_cast<std::size_t>(std::ranges::find(values, missing) == values.end()); });
+		report("  list::find (miss)", elements,
+			[&] { return static_cast<std::size_t>(values.find(missing) == values.end()); });
+		report("  std::ranges::equal", elements,
+			[&] { return static_cast<std::size_t>(std::ranges::equal(values, copy)); });
+		report("  list::operator==", elements, [&] { return static_cast<std::size_t>(values == copy); });
+
+		auto scalar = values;
+		report("  list::remove_if(== value)", elements,
+			[&] { return scalar.remove_if([&](const T& value) { return value == needle; }); });
+		report("  list::remove(value)", elements, [&] { return values.remove(needle); });
+	}
+}
+
+int main()
+{
+	run<std::int32_t>("int32");
+	run<std::int64_t>("int64");
+	run<float>("float");
+	run<double>("double");
+}
@@ -0,0 +1,144 @@
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <latch>
+#include <list>
+#include <mutex>
+#include <print>
+#include <thread>
+
+#include "../channel.hpp"
+
+namespace
+{
+	constexpr std::size_t items = 2'000'000;
+	constexpr std::size_t capacity = 1'024;
+
+	class locked_queue
+	{
+	public:
+		void push(std::uint64_t value)
+		{
+			std::unique_lock lock{ mutex_ };
+			not_full_.wait(lock, [this] { return items_.size() < capacity; });
+			items_.push_back(value);
+			not_empty_.notify_one();
+		}
+
+		std::uint64_t pop()
+		{
+			std::unique_lock lock{ mutex_ };
+			not_empty_.wait(lock, [this] { return !items_.empty(); });
+			const std::uint64_t value = items_.front();
+			items_.pop_front();
+			not_full_.notify_one();
+			return value;
+		}
+
+	private:
+		std::mutex mutex_;
+		std::condition_variable not_empty_;
+		std::condition_variable not_full_;
+		std::list<std::uint64_t> items_;
+	};
+
+	template <typename F>
+	void report(const char* name, F run)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const std::uint64_t sum = run();
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		std::println("{:<36} {:8.2f} Mitems/s  (checksum {})",
+			name, static_cast<double>(items) / elapsed.count() / 1e6, sum);
+	}
+
+	using channel = constexpr_list::async::channel<std::uint64_t>;
+	using constexpr_list::async::detached_task;
+
+	detached_task produce(channel& ch)
+	{
+		for (std::uint64_t i = 0; i < items; ++i)
+		{
+			co_await ch.push(i);
+		}
+
+		ch.close();
+	}
+
+	detached_task consume_one(channel& ch, std::uint64_t& sum, std::latch& done)
+	{
+		while (auto value = co_await ch.pop())
+		{
+			sum += *value;
+		}
+
+		done.count_down();
+	}
+
+	detached_task consume_batch(channel& ch, std::size_t batch, std::uint64_t& sum, std::latch& done)
+	{
+		while (true)
+		{
+			auto values = co_await ch.pop_batch(batch);
+
+			if (values.empty())
+			{
+				break;
+			}
+
+			for (std::uint64_t value : values)
+			{
+				sum += value;
+			}
+		}
+
+		done.count_down();
+	}
+}
+
+int main()
+{
+	report("mutex + condition_variable + list", []
+	{
+		locked_queue queue;
+		std::uint64_t sum = 0;
+		std::jthread producer([&] { for (std::uint64_t i = 0; i < items; ++i) queue.push(i); });
+
+		for (std::size_t i = 0; i < items; ++i)
+		{
+			sum += queue.pop();
+		}
+
+		return sum;
+	});
+
+	report("channel, pop()", []
+	{
+		std::uint64_t sum = 0;
+		std::latch done(1);
+		constexpr_list::async::thread_pool_executor executor(2);
+		channel ch(executor, capacity);
+
+		spawn(executor, consume_one(ch, sum, done));
+		spawn(executor, produce(ch));
+		done.wait();
+		return sum;
+	});
+
+	for (std::size_t batch : { 16uz, 256uz })
+	{
+		report(batch == 16 ? "channel, pop_batch(16)" : "channel, pop_batch(256)", [batch]
+		{
+			std::uint64_t sum = 0;
+			std::latch done(1);
+			constexpr_list::async::thread_pool_executor executor(2);
+			channel ch(executor, capacity);
+
+			spawn(executor, consume_batch(ch, batch, sum, done));
+			spawn(executor, produce(ch));
+			done.wait();
+			return sum;
+		});
+	}
+}
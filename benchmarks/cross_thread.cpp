@@ -0,0 +1,90 @@
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <print>
+#include <thread>
+
+#include "../thread_aware_allocator.hpp"
+
+namespace
+{
+	constexpr std::size_t elements = 10'000'000;
+	constexpr std::size_t chunk = 1024;
+
+	template <typename F>
+	double measure_ms(F f)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		f();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	template <typename List>
+	double pipeline(const typename List::allocator_type& alloc)
+	{
+		std::mutex mutex;
+		List shared(alloc);
+		std::uint64_t sum = 0;
+
+		const double elapsed = measure_ms([&]
+		{
+			std::jthread producer([&]
+			{
+				List batch(alloc);
+
+				for (std::size_t i = 0; i < elements; ++i)
+				{
+					batch.push_back(i);
+
+					if (batch.size() == chunk)
+					{
+						std::scoped_lock lock{ mutex };
+						shared.splice(shared.end(), batch);
+					}
+				}
+
+				std::scoped_lock lock{ mutex };
+				shared.splice(shared.end(), batch);
+			});
+
+			List local(alloc);
+			std::size_t consumed = 0;
+
+			while (consumed < elements)
+			{
+				{
+					std::scoped_lock lock{ mutex };
+					local.splice(local.end(), shared);
+				}
+
+				while (!local.empty())
+				{
+					sum += local.front();
+					local.pop_front();
+					++consumed;
+				}
+			}
+		});
+
+		if (sum != elements * (elements - 1) / 2)
+		{
+			std::println("checksum mismatch");
+		}
+
+		return elapsed;
+	}
+}
+
+int main()
+{
+	std::println("{:<24} {:10.2f} ms", "std::allocator",
+		pipeline<constexpr_list::list<std::uint64_t>>({}));
+
+	constexpr_list::thread_aware_pool pool;
+	const double pooled = pipeline<constexpr_list::list<std::uint64_t, constexpr_list::thread_aware_allocator<std::uint64_t>>>(pool);
+	const constexpr_list::thread_aware_stats stats = pool.stats();
+
+	std::println("{:<24} {:10.2f} ms", "thread_aware_allocator", pooled);
+	std::println("{:<24} allocations {} local frees {} remote frees {} batches sent {} received {}", "",
+		stats.allocations, stats.local_frees, stats.remote_frees, stats.batches_sent, stats.batches_received);
+}
@@ -0,0 +1,107 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <print>
+#include <random>
+
+#include "../arena.hpp"
+#include "../hot_cold_list.hpp"
+
+namespace
+{
+	constexpr std::size_t elements = 1'000'000;
+
+	struct record
+	{
+		std::uint64_t key;
+		std::array<std::uint64_t, 31> payload;
+	};
+
+	struct by_key
+	{
+		std::uint64_t operator()(const record& value) const noexcept
+		{
+			return value.key;
+		}
+	};
+
+	template <typename F>
+	double measure_ms(F f)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		f();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	template <typename List, typename Key, typename ... Args>
+	void run(const char* name, Key key, Args&& ... args)
+	{
+		List values(std::forward<Args>(args)...);
+		std::mt19937_64 rng{ 42 };
+
+		for (std::size_t i = 0; i < elements; ++i)
+		{
+			values.emplace_back(rng() % elements, std::array<std::uint64_t, 31>{ i });
+		}
+
+		const double sort = measure_ms([&] { values.sort(); });
+
+		std::uint64_t sum = 0;
+		const double scan = measure_ms([&]
+		{
+			for (int pass = 0; pass < 8; ++pass)
+			{
+				for (auto it = values.begin(); it != values.end(); ++it)
+				{
+					sum += key(it);
+				}
+			}
+		});
+
+		const double unique = measure_ms([&] { values.unique(); });
+
+		std::println("{:<16} sort {:9.2f} ms   scan x8 {:9.2f} ms   unique {:9.2f} ms   {} left (checksum {})",
+			name, sort, scan, unique, values.size(), sum);
+	}
+}
+
+int main()
+{
+	std::println("{} records of {} bytes", elements, sizeof(record));
+
+	struct by_key_less
+	{
+		bool operator()(const record& lhs, const record& rhs) const noexcept
+		{
+			return lhs.key < rhs.key;
+		}
+	};
+
+	using base_list = constexpr_list::list<record, constexpr_list::arena_allocator<record>>;
+
+	struct inline_list : base_list
+	{
+		using base_list::base_list;
+
+		void sort()
+		{
+			base_list::sort(by_key_less{});
+		}
+
+		void unique()
+		{
+			base_list::unique([](const record& lhs, const record& rhs) { return lhs.key == rhs.key; });
+		}
+	};
+
+	{
+		constexpr_list::arena arena;
+		run<inline_list>("inline payload", [](auto it) { return it->key; }, arena);
+	}
+
+	{
+		constexpr_list::arena arena;
+		run<constexpr_list::hot_cold_list<record, by_key, constexpr_list::arena_allocator<record>, std::allocator<record>>>(
+			"hot/cold layout", [](auto it) { return it.key(); }, by_key{}, arena, std::allocator<record>{});
+	}
+}
@@ -0,0 +1,101 @@
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <print>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "../huge_page_arena.hpp"
+
+namespace
+{
+	template <typename F>
+	double measure_ms(F f)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		f();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	std::string first_line(const char* path, std::string_view prefix = {})
+	{
+		std::ifstream file(path);
+
+		for (std::string line; std::getline(file, line);)
+		{
+			if (line.starts_with(prefix))
+			{
+				return line;
+			}
+		}
+
+		return "n/a";
+	}
+
+	template <typename List, typename ... Args>
+	void run(const char* name, std::size_t elements, Args&& ... args)
+	{
+		std::optional<List> values;
+		values.emplace(std::forward<Args>(args)...);
+
+		std::mt19937_64 rng{ 42 };
+
+		for (std::size_t i = 0; i < elements; ++i)
+		{
+			values->push_back(rng());
+		}
+
+		values->sort();
+
+		std::uint64_t sum = 0;
+		const double traverse = measure_ms([&]
+		{
+			for (int pass = 0; pass < 8; ++pass)
+			{
+				for (const std::uint64_t value : *values)
+				{
+					sum += value;
+				}
+			}
+		});
+
+		const double sort = measure_ms([&] { values->sort([](std::uint64_t a, std::uint64_t b) { return (a >> 17 ^ a) < (b >> 17 ^ b); }); });
+
+		std::println("{:<20} traverse x8 {:9.2f} ms   sort {:9.2f} ms   {}", name, traverse, sort,
+			first_line("/proc/self/smaps_rollup", "AnonHugePages"));
+
+		values.reset();
+
+		if (sum == 0)
+		{
+			std::println("unexpected checksum");
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::size_t elements = 8'000'000;
+
+	if (argc > 1)
+	{
+		std::from_chars(argv[1], argv[1] + std::char_traits<char>::length(argv[1]), elements);
+	}
+
+	std::println("{} nodes, THP: {}", elements, first_line("/sys/kernel/mm/transparent_hugepage/enabled"));
+
+	run<constexpr_list::list<std::uint64_t>>("std::allocator", elements);
+
+	{
+		constexpr_list::small_page_arena arena;
+		run<constexpr_list::list<std::uint64_t, constexpr_list::small_page_allocator<std::uint64_t>>>("4 KiB page arena", elements, arena);
+	}
+
+	{
+		constexpr_list::huge_page_arena arena;
+		run<constexpr_list::list<std::uint64_t, constexpr_list::huge_page_allocator<std::uint64_t>>>("huge page arena", elements, arena);
+	}
+}
@@ -0,0 +1,126 @@
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <print>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "../lru_cache.hpp"
+
+namespace
+{
+	class hand_rolled_lru
+	{
+	public:
+		explicit hand_rolled_lru(std::size_t capacity)
+			: capacity_{ capacity }
+		{
+			index_.reserve(capacity * 2);
+		}
+
+		std::uint64_t* get(std::uint64_t key)
+		{
+			auto found = index_.find(key);
+
+			if (found == index_.end())
+			{
+				return nullptr;
+			}
+
+			entries_.splice(entries_.begin(), entries_, found->second);
+			return &found->second->second;
+		}
+
+		void put(std::uint64_t key, std::uint64_t value)
+		{
+			auto found = index_.find(key);
+
+			if (found != index_.end())
+			{
+				found->second->second = value;
+				entries_.splice(entries_.begin(), entries_, found->second);
+				return;
+			}
+
+			if (entries_.size() == capacity_)
+			{
+				index_.erase(entries_.back().first);
+				entries_.pop_back();
+			}
+
+			entries_.emplace_front(key, value);
+			index_.emplace(key, entries_.begin());
+		}
+
+	private:
+		using entry_list = std::list<std::pair<std::uint64_t, std::uint64_t>>;
+
+		entry_list entries_;
+		std::unordered_map<std::uint64_t, entry_list::iterator> index_;
+		std::size_t capacity_;
+	};
+
+	std::vector<std::uint64_t> make_workload(std::size_t count, std::size_t universe)
+	{
+		std::mt19937_64 rng{ 42 };
+		std::vector<double> weights(universe);
+
+		for (std::size_t i = 0; i < universe; ++i)
+		{
+			weights[i] = 1.0 / static_cast<double>(i + 1);
+		}
+
+		std::discrete_distribution<std::size_t> zipf(weights.begin(), weights.end());
+		std::vector<std::uint64_t> keys(count);
+
+		for (auto& key : keys)
+		{
+			key = zipf(rng) * 0x9E3779B97F4A7C15ull;
+		}
+
+		return keys;
+	}
+
+	template <typename Cache>
+	void run(const char* name, Cache cache, const std::vector<std::uint64_t>& keys)
+	{
+		std::size_t hits = 0;
+		const auto start = std::chrono::steady_clock::now();
+
+		for (std::uint64_t key : keys)
+		{
+			if (auto* value = cache.get(key))
+			{
+				++*value;
+				++hits;
+			}
+			else
+			{
+				cache.put(key, key);
+			}
+		}
+
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		std::println("{:<28} hit rate {:6.2f}%  {:8.2f} Mops/s",
+			name,
+			100.0 * static_cast<double>(hits) / static_cast<double>(keys.size()),
+			static_cast<double>(keys.size()) / elapsed.count() / 1e6);
+	}
+}
+
+int main()
+{
+	constexpr std::size_t operations = 10'000'000;
+	constexpr std::size_t universe = 1'000'000;
+
+	const auto keys = make_workload(operations, universe);
+
+	for (std::size_t capacity : { 1'000uz, 10'000uz, 100'000uz })
+	{
+		std::println("capacity {}", capacity);
+		run("std::unordered_map + list", hand_rolled_lru(capacity), keys);
+		run("constexpr_list::lru_cache", constexpr_list::lru_cache<std::uint64_t, std::uint64_t>(capacity), keys);
+	}
+}
@@ -0,0 +1,57 @@
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <print>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../execution.hpp"
+
+namespace
+{
+	template <typename F>
+	double measure_ms(F f)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		f();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	template <typename ... Policy>
+	void run(const char* name, const std::vector<std::uint64_t>& source, Policy&& ... policy)
+	{
+		std::uint64_t last = 0;
+		const double build = measure_ms([&]
+		{
+			constexpr_list::list<std::uint64_t> values(std::from_range, std::forward<Policy>(policy)..., source);
+			last = values.back();
+		});
+
+		std::println("{:<24} {:10.2f} ms", name, build);
+
+		if (last != source.back())
+		{
+			std::println("unexpected tail element");
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::size_t elements = 50'000'000;
+
+	if (argc > 1)
+	{
+		std::from_chars(argv[1], argv[1] + std::char_traits<char>::length(argv[1]), elements);
+	}
+
+	std::vector<std::uint64_t> source(elements);
+	std::iota(source.begin(), source.end(), 0);
+
+	std::println("{} elements, {} hardware threads (build + destroy)", elements, std::thread::hardware_concurrency());
+	run("from_range", source);
+	run("from_range, seq", source, std::execution::seq);
+	run("from_range, par", source, std::execution::par);
+}
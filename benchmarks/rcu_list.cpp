@@ -0,0 +1,118 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <print>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "../rcu_list.hpp"
+
+namespace
+{
+	constexpr std::size_t routes = 64;
+	constexpr auto duration = std::chrono::milliseconds{ 500 };
+	constexpr auto write_interval = std::chrono::milliseconds{ 10 };
+
+	struct locked_list
+	{
+		template <typename F>
+		void for_each(F f) const
+		{
+			std::shared_lock lock{ mutex_ };
+
+			for (const std::uint64_t value : values_)
+			{
+				f(value);
+			}
+		}
+
+		void rotate(std::uint64_t value)
+		{
+			std::scoped_lock lock{ mutex_ };
+			values_.pop_front();
+			values_.push_back(value);
+		}
+
+		mutable std::shared_mutex mutex_;
+		constexpr_list::list<std::uint64_t> values_;
+	};
+
+	struct rcu_routes
+	{
+		template <typename F>
+		void for_each(F f) const
+		{
+			values_.for_each(f);
+		}
+
+		void rotate(std::uint64_t value)
+		{
+			const std::uint64_t oldest = *values_.read().begin();
+			values_.erase_if([&](std::uint64_t element) { return element == oldest; });
+			values_.push_back(value);
+		}
+
+		constexpr_list::concurrent::rcu_list<std::uint64_t> values_;
+	};
+
+	template <typename Routes>
+	double reads_per_second(Routes& table, unsigned readers)
+	{
+		std::atomic<bool> stop = false;
+		std::atomic<std::uint64_t> total = 0;
+		std::vector<std::jthread> threads;
+
+		for (unsigned i = 0; i < readers; ++i)
+		{
+			threads.emplace_back([&]
+			{
+				std::uint64_t reads = 0;
+				std::uint64_t sum = 0;
+
+				while (!stop.load(std::memory_order_relaxed))
+				{
+					table.for_each([&](std::uint64_t value) { sum += value; });
+					++reads;
+				}
+
+				total.fetch_add(reads + (sum == 1), std::memory_order_relaxed);
+			});
+		}
+
+		std::uint64_t next = routes;
+		const auto deadline = std::chrono::steady_clock::now() + duration;
+
+		while (std::chrono::steady_clock::now() < deadline)
+		{
+			std::this_thread::sleep_for(write_interval);
+			table.rotate(next++);
+		}
+
+		stop = true;
+		threads.clear();
+		return static_cast<double>(total.load()) / std::chrono::duration<double>(duration).count();
+	}
+}
+
+int main()
+{
+	const unsigned cores = std::max(std::thread::hardware_concurrency(), 1u);
+
+	locked_list locked;
+	rcu_routes rcu;
+
+	for (std::uint64_t i = 0; i < routes; ++i)
+	{
+		locked.values_.push_back(i);
+		rcu.values_.push_back(i);
+	}
+
+	std::println("{:>8} {:>20} {:>20}", "readers", "shared_mutex reads/s", "rcu_list reads/s");
+
+	for (unsigned readers = 1; readers <= 2 * cores; readers *= 2)
+	{
+		std::println("{:8} {:20.0f} {:20.0f}", readers, reads_per_second(locked, readers), reads_per_second(rcu, readers));
+	}
+}
@@ -0,0 +1,68 @@
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <print>
+
+#include "../background_reclaimer.hpp"
+
+namespace
+{
+	constexpr std::size_t elements = 10'000'000;
+
+	constexpr_list::list<std::uint64_t> make_list()
+	{
+		constexpr_list::list<std::uint64_t> values;
+
+		for (std::size_t i = 0; i < elements; ++i)
+		{
+			values.push_back(i);
+		}
+
+		return values;
+	}
+
+	template <typename F>
+	double measure_ms(F f)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		f();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+int main()
+{
+	{
+		auto values = make_list();
+		std::println("{:<40} {:10.3f} ms", "clear()", measure_ms([&] { values.clear(); }));
+	}
+
+	{
+		auto values = make_list();
+		std::optional<decltype(values)::reclaimer> detached;
+		std::println("{:<40} {:10.3f} ms", "detach_for_reclaim()",
+			measure_ms([&] { detached.emplace(values.detach_for_reclaim()); }));
+
+		auto& reclaimer = *detached;
+
+		double worst = 0.0;
+		std::size_t slices = 0;
+
+		while (!reclaimer.empty())
+		{
+			worst = std::max(worst, measure_ms([&] { reclaimer.reclaim(4096); }));
+			++slices;
+		}
+
+		std::println("{:<40} {:10.3f} ms over {} slices", "reclaim(4096), worst slice", worst, slices);
+	}
+
+	{
+		constexpr_list::background_reclaimer background;
+		auto values = make_list();
+		std::println("{:<40} {:10.3f} ms", "submit to background_reclaimer",
+			measure_ms([&] { background.submit(values.detach_for_reclaim()); }));
+		std::println("{:<40} {:10.3f} ms", "background drain (wait_idle)",
+			measure_ms([&] { background.wait_idle(); }));
+	}
+}
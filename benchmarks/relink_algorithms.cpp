@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <print>
+#include <random>
+#include <vector>
+
+#include "../constexpr_list.hpp"
+
+namespace
+{
+	constexpr std::size_t elements = 100'000;
+
+	struct record
+	{
+		std::uint64_t key;
+		std::array<std::byte, 1016> payload;
+	};
+
+	template <typename F>
+	double measure_ms(F f)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		f();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	constexpr_list::list<record> make_records()
+	{
+		constexpr_list::list<record> records;
+
+		for (std::size_t i = 0; i < elements; ++i)
+		{
+			records.push_back(record{ i, {} });
+		}
+
+		return records;
+	}
+
+	void report(const char* name, double generic, double relinked)
+	{
+		std::println("{:<16} generic {:9.2f} ms   relinking {:9.3f} ms", name, generic, relinked);
+	}
+}
+
+int main()
+{
+	auto records = make_records();
+	const auto by_key = [](const record& a, const record& b) { return a.key < b.key; };
+	std::mt19937_64 rng{ 7 };
+
+	{
+		const double generic = measure_ms([&] { std::ranges::rotate(records, std::ranges::next(records.begin(), elements / 3)); });
+		const double relinked = measure_ms([&] { records.rotate(std::ranges::next(records.begin(), elements / 3)); });
+		report("rotate", generic, relinked);
+	}
+
+	{
+		const auto range = [&] { return std::ranges::subrange(std::ranges::next(records.begin(), elements / 4), std::ranges::next(records.begin(), 3 * elements / 4)); };
+		const double generic = measure_ms([&] { std::ranges::reverse(range()); });
+		const double relinked = measure_ms([&] { records.reverse(range().begin(), range().end()); });
+		report("reverse range", generic, relinked);
+	}
+
+	{
+		records.shuffle(rng);
+		const double generic = measure_ms([&]
+		{
+			std::vector<record> values(records.begin(), records.end());
+			std::ranges::nth_element(values, values.begin() + elements / 2, by_key);
+			std::ranges::copy(values, records.begin());
+		});
+
+		records.shuffle(rng);
+		const double relinked = measure_ms([&] { records.nth_element(elements / 2, by_key); });
+		report("nth_element", generic, relinked);
+	}
+
+	{
+		records.shuffle(rng);
+		const double generic = measure_ms([&]
+		{
+			std::vector<record> values(records.begin(), records.end());
+			std::ranges::partial_sort(values, values.begin() + 100, by_key);
+			std::ranges::copy(values, records.begin());
+		});
+
+		records.shuffle(rng);
+		const double relinked = measure_ms([&] { records.partial_sort(100, by_key); });
+		report("partial_sort 100", generic, relinked);
+	}
+
+	{
+		const double generic = measure_ms([&]
+		{
+			std::vector<record> values(records.begin(), records.end());
+			std::ranges::shuffle(values, rng);
+			std::ranges::copy(values, records.begin());
+		});
+
+		const double relinked = measure_ms([&] { records.shuffle(rng); });
+		report("shuffle", generic, relinked);
+	}
+}
@@ -0,0 +1,106 @@
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <print>
+
+#include "../constexpr_list.hpp"
+
+namespace
+{
+	constexpr std::size_t buckets = 1'000'000;
+	constexpr std::size_t per_bucket = 4;
+
+	template <typename F>
+	double measure_ms(F f)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		f();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	template <typename List>
+	class bucket_table
+	{
+	public:
+		bucket_table(const bucket_table&) = delete;
+		bucket_table& operator=(const bucket_table&) = delete;
+
+		explicit bucket_table(std::size_t capacity)
+		{
+			this->reserve(capacity);
+		}
+
+		~bucket_table()
+		{
+			std::destroy_n(data_, size_);
+			std::allocator<List>{}.deallocate(data_, capacity_);
+		}
+
+		List& emplace_back()
+		{
+			return *std::construct_at(data_ + size_++);
+		}
+
+		void reserve(std::size_t capacity)
+		{
+			List* fresh = std::allocator<List>{}.allocate(capacity);
+
+			if constexpr (constexpr_list::is_trivially_relocatable_v<List>)
+			{
+				std::memcpy(static_cast<void*>(fresh), static_cast<const void*>(data_), size_ * sizeof(List));
+			}
+			else
+			{
+				std::uninitialized_move_n(data_, size_, fresh);
+				std::destroy_n(data_, size_);
+			}
+
+			std::allocator<List>{}.deallocate(data_, capacity_);
+			data_ = fresh;
+			capacity_ = capacity;
+		}
+
+		std::size_t capacity() const noexcept
+		{
+			return capacity_;
+		}
+
+	private:
+		List* data_ = nullptr;
+		std::size_t size_ = 0;
+		std::size_t capacity_ = 0;
+	};
+
+	template <typename List>
+	void run(const char* name)
+	{
+		bucket_table<List> table(buckets);
+
+		for (std::size_t i = 0; i < buckets; ++i)
+		{
+			List& bucket = table.emplace_back();
+
+			for (std::size_t j = 0; j < per_bucket; ++j)
+			{
+				bucket.push_back(i + j);
+			}
+		}
+
+		double grow = 0.0;
+
+		for (int round = 0; round < 8; ++round)
+		{
+			grow += measure_ms([&] { table.reserve(table.capacity() + 1); });
+		}
+
+		std::println("{:<28} trivially relocatable {:5}   8 reallocations {:9.2f} ms", name,
+			constexpr_list::is_trivially_relocatable_v<List>, grow);
+	}
+}
+
+int main()
+{
+	run<constexpr_list::list<std::uint64_t>>("embedded_sentinel");
+	run<constexpr_list::list<std::uint64_t, std::allocator<std::uint64_t>, constexpr_list::heap_sentinel>>("heap_sentinel");
+}
@@ -0,0 +1,253 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <list>
+#include <optional>
+#include <print>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../recording_list.hpp"
+
+namespace
+{
+	using value = std::uint64_t;
+
+	struct memory_counter
+	{
+		static inline std::size_t live = 0;
+		static inline std::size_t peak = 0;
+	};
+
+	template <typename T>
+	struct counting_allocator
+	{
+		using value_type = T;
+
+		counting_allocator() = default;
+
+		template <typename U>
+		counting_allocator(const counting_allocator<U>&) noexcept
+		{}
+
+		T* allocate(std::size_t n)
+		{
+			memory_counter::live += n * sizeof(T);
+			memory_counter::peak = std::max(memory_counter::peak, memory_counter::live);
+			return std::allocator<T>{}.allocate(n);
+		}
+
+		void deallocate(T* ptr, std::size_t n) noexcept
+		{
+			memory_counter::live -= n * sizeof(T);
+			std::allocator<T>{}.deallocate(ptr, n);
+		}
+
+		template <typename U>
+		friend bool operator==(const counting_allocator&, const counting_allocator<U>&) noexcept
+		{
+			return true;
+		}
+	};
+
+	template <bool Timed, typename List>
+	double replay_pass(const std::vector<constexpr_list::trace_record>& trace, std::vector<std::uint32_t>& latencies)
+	{
+		using constexpr_list::trace_op;
+
+		std::deque<std::optional<List>> lists;
+		std::vector<typename List::iterator> nodes(1);
+		nodes.reserve(trace.size());
+
+		const auto position = [&](List& list, std::uint64_t id)
+		{
+			return id == 0 ? list.end() : nodes[id];
+		};
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for (const constexpr_list::trace_record& record : trace)
+		{
+			const auto op_start = Timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+
+			if (record.op == trace_op::create_list)
+			{
+				lists.emplace_back(std::in_place);
+				continue;
+			}
+
+			List& list = *lists[record.list];
+			const auto& args = record.args;
+
+			switch (record.op)
+			{
+			case trace_op::destroy_list:
+				lists[record.list].reset();
+				break;
+			case trace_op::push_back:
+				list.push_back(args[0]);
+				nodes.push_back(std::ranges::prev(list.end()));
+				break;
+			case trace_op::push_front:
+				list.push_front(args[0]);
+				nodes.push_back(list.begin());
+				break;
+			case trace_op::insert:
+				nodes.push_back(list.insert(position(list, args[0]), args[1]));
+				break;
+			case trace_op::erase:
+				list.erase(nodes[args[0]]);
+				break;
+			case trace_op::pop_front:
+				list.pop_front();
+				break;
+			case trace_op::pop_back:
+				list.pop_back();
+				break;
+			case trace_op::splice:
+				list.splice(position(list, args[0]), *lists[args[1]]);
+				break;
+			case trace_op::splice_one:
+				list.splice(position(list, args[0]), *lists[args[1]], nodes[args[2]]);
+				break;
+			case trace_op::splice_range:
+				list.splice(position(list, args[0]), *lists[args[1]], nodes[args[2]], position(*lists[args[1]], args[3]));
+				break;
+			case trace_op::sort:
+				list.sort();
+				break;
+			case trace_op::merge:
+				list.merge(*lists[args[0]]);
+				break;
+			case trace_op::clear:
+				list.clear();
+				break;
+			default:
+				break;
+			}
+
+			if constexpr (Timed)
+			{
+				latencies.push_back(static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now() - op_start).count()));
+			}
+		}
+
+		lists.clear();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	template <typename List>
+	void replay(const char* name, const std::vector<constexpr_list::trace_record>& trace)
+	{
+		std::vector<std::uint32_t> latencies;
+		latencies.reserve(trace.size());
+
+		memory_counter::live = 0;
+		memory_counter::peak = 0;
+
+		const double seconds = replay_pass<false, List>(trace, latencies);
+		const std::size_t peak = memory_counter::peak;
+		replay_pass<true, List>(trace, latencies);
+
+		if (latencies.empty())
+		{
+			std::println("{:<28} no list operations in the trace", name);
+			return;
+		}
+
+		const auto percentile = [&](double p)
+		{
+			const auto nth = latencies.begin() + static_cast<std::ptrdiff_t>(p * static_cast<double>(latencies.size() - 1));
+			std::ranges::nth_element(latencies, nth);
+			return *nth;
+		};
+
+		const std::uint32_t p50 = percentile(0.5);
+		const std::uint32_t p99 = percentile(0.99);
+		const std::uint32_t p999 = percentile(0.999);
+		const std::uint32_t max = std::ranges::max(latencies);
+
+		std::println("{:<28} {:8.2f} Mops/s   p50 {:6} ns   p99 {:6} ns   p99.9 {:7} ns   max {:9} ns   peak {:8.2f} MiB",
+			name, static_cast<double>(trace.size()) / seconds / 1e6, p50, p99, p999, max,
+			static_cast<double>(peak) / (1 << 20));
+	}
+
+	void record_synthetic(const char* path)
+	{
+		constexpr_list::trace_recorder recorder(path);
+		constexpr_list::recording_list<value> queue(recorder);
+		constexpr_list::recording_list<value> batch(recorder);
+		std::vector<constexpr_list::recording_list<value>::iterator> live;
+		std::mt19937_64 rng{ 42 };
+
+		for (int round = 0; round < 200; ++round)
+		{
+			for (int i = 0; i < 2000; ++i)
+			{
+				batch.push_back(rng() % 1'000'000);
+			}
+
+			batch.sort();
+			queue.merge(batch);
+
+			for (int i = 0; i < 500; ++i)
+			{
+				queue.push_back(rng() % 1'000'000);
+				live.push_back(std::ranges::prev(queue.end()));
+			}
+
+			for (int i = 0; i < 400 && !live.empty(); ++i)
+			{
+				const std::size_t victim = rng() % live.size();
+				queue.erase(live[victim]);
+				live[victim] = live.back();
+				live.pop_back();
+			}
+
+			live.clear();
+
+			for (int i = 0; i < 1500; ++i)
+			{
+				queue.pop_front();
+			}
+
+			queue.sort();
+		}
+
+		queue.clear();
+		recorder.flush();
+	}
+}
+
+#define REPLAY_STRINGIFY_(x) #x
+#define REPLAY_STRINGIFY(x) REPLAY_STRINGIFY_(x)
+
+int main(int argc, char** argv)
+{
+	std::string path;
+
+	if (argc > 1)
+	{
+		path = argv[1];
+	}
+	else
+	{
+		path = (std::filesystem::temp_directory_path() / "constexpr_list_replay.trace").string();
+		record_synthetic(path.c_str());
+	}
+
+	const std::vector<constexpr_list::trace_record> trace = constexpr_list::read_trace(path.c_str());
+	std::println("{}: {} operations", path, trace.size());
+
+	replay<constexpr_list::list<value, counting_allocator<value>>>("constexpr_list::list", trace);
+	replay<constexpr_list::list<value, counting_allocator<value>, constexpr_list::heap_sentinel>>("list<heap_sentinel>", trace);
+	replay<std::list<value, counting_allocator<value>>>("std::list", trace);
+
+#ifdef REPLAY_LIST
+	replay<REPLAY_LIST>(REPLAY_STRINGIFY(REPLAY_LIST), trace);
+#endif
+}
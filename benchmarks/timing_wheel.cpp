@@ -0,0 +1,122 @@
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <print>
+#include <random>
+#include <vector>
+
+#include "../timing_wheel.hpp"
+
+namespace
+{
+	constexpr std::size_t timers = 1'000'000;
+	constexpr std::uint64_t horizon = 1 << 20;
+
+	template <typename F>
+	double measure_ms(F f)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		f();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	void report(const char* name, double schedule, double cancel, double expire, std::uint64_t fired)
+	{
+		std::println("{:<16} schedule {:8.2f} ms   cancel 1/4 {:8.2f} ms   run {:8.2f} ms   fired {}",
+			name, schedule, cancel, expire, fired);
+	}
+
+	void run_wheel(const std::vector<std::uint64_t>& delays)
+	{
+		constexpr_list::timing_wheel<std::uint64_t> wheel;
+		std::vector<constexpr_list::timing_wheel<std::uint64_t>::handle> handles;
+		handles.reserve(delays.size());
+
+		const double schedule = measure_ms([&]
+		{
+			for (std::size_t i = 0; i < delays.size(); ++i)
+			{
+				handles.push_back(wheel.schedule(delays[i], i));
+			}
+		});
+
+		const double cancel = measure_ms([&]
+		{
+			for (std::size_t i = 0; i < handles.size(); i += 4)
+			{
+				wheel.cancel(handles[i]);
+			}
+		});
+
+		std::uint64_t fired = 0;
+		constexpr_list::timing_wheel<std::uint64_t>::timer_list expired;
+
+		const double expire = measure_ms([&]
+		{
+			while (!wheel.empty())
+			{
+				wheel.advance(expired);
+				fired += expired.size();
+				expired.clear();
+			}
+		});
+
+		report("timing_wheel", schedule, cancel, expire, fired);
+	}
+
+	void run_multimap(const std::vector<std::uint64_t>& delays)
+	{
+		std::multimap<std::uint64_t, std::uint64_t> queue;
+		std::vector<std::multimap<std::uint64_t, std::uint64_t>::iterator> handles;
+		handles.reserve(delays.size());
+
+		const double schedule = measure_ms([&]
+		{
+			for (std::size_t i = 0; i < delays.size(); ++i)
+			{
+				handles.push_back(queue.emplace(delays[i], i));
+			}
+		});
+
+		const double cancel = measure_ms([&]
+		{
+			for (std::size_t i = 0; i < handles.size(); i += 4)
+			{
+				queue.erase(handles[i]);
+			}
+		});
+
+		std::uint64_t fired = 0;
+
+		const double expire = measure_ms([&]
+		{
+			for (std::uint64_t now = 1; !queue.empty(); ++now)
+			{
+				while (!queue.empty() && queue.begin()->first <= now)
+				{
+					queue.erase(queue.begin());
+					++fired;
+				}
+			}
+		});
+
+		report("std::multimap", schedule, cancel, expire, fired);
+	}
+}
+
+int main()
+{
+	std::mt19937_64 rng{ 42 };
+	std::uniform_int_distribution<std::uint64_t> delay{ 1, horizon };
+	std::vector<std::uint64_t> delays(timers);
+
+	for (std::uint64_t& value : delays)
+	{
+		value = delay(rng);
+	}
+
+	std::println("{} timers over {} ticks", timers, horizon);
+
+	run_wheel(delays);
+	run_multimap(delays);
+}
@@ -0,0 +1,605 @@
+#ifndef CONSTEXPR_LIST_CHANNEL
+#define CONSTEXPR_LIST_CHANNEL
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+#include "constexpr_list.hpp"
+
+namespace constexpr_list::async
+{
+	class executor_ref
+	{
+	public:
+		template <typename Executor>
+			requires (!std::same_as<std::remove_cvref_t<Executor>, executor_ref>)
+				&& requires (Executor& ex, std::coroutine_handle<> handle) { ex.schedule(handle); }
+		executor_ref(Executor& ex) noexcept
+			: executor_{ std::addressof(ex) }
+			, schedule_{ [](void* executor, std::coroutine_handle<> handle)
+				{
+					static_cast<Executor*>(executor)->schedule(handle);
+				} }
+		{}
+
+		void schedule(std::coroutine_handle<> handle) const
+		{
+			schedule_(executor_, handle);
+		}
+
+	private:
+		void* executor_;
+		void (*schedule_)(void*, std::coroutine_handle<>);
+	};
+
+	class single_thread_executor
+	{
+	public:
+		single_thread_executor() = default;
+
+		single_thread_executor(const single_thread_executor&) = delete;
+		single_thread_executor& operator=(const single_thread_executor&) = delete;
+
+		~single_thread_executor()
+		{
+			while (!ready_.empty())
+			{
+				std::coroutine_handle<> handle = ready_.front();
+				ready_.pop_front();
+				handle.destroy();
+			}
+		}
+
+		void schedule(std::coroutine_handle<> handle)
+		{
+			std::scoped_lock lock{ mutex_ };
+			ready_.push_back(handle);
+		}
+
+		bool run_one()
+		{
+			std::coroutine_handle<> handle;
+			{
+				std::scoped_lock lock{ mutex_ };
+
+				if (ready_.empty())
+				{
+					return false;
+				}
+
+				handle = ready_.front();
+				ready_.pop_front();
+			}
+
+			handle.resume();
+			return true;
+		}
+
+		std::size_t run()
+		{
+			std::size_t resumed = 0;
+
+			while (this->run_one())
+			{
+				++resumed;
+			}
+
+			return resumed;
+		}
+
+	private:
+		std::mutex mutex_;
+		list<std::coroutine_handle<>> ready_;
+	};
+
+	class thread_pool_executor
+	{
+	public:
+		explicit thread_pool_executor(std::size_t threads = std::max(std::thread::hardware_concurrency(), 1u))
+		{
+			workers_.reserve(threads);
+
+			for (std::size_t i = 0; i < threads; ++i)
+			{
+				workers_.emplace_back([this](std::stop_token stop) { this->work_(stop); });
+			}
+		}
+
+		thread_pool_executor(const thread_pool_executor&) = delete;
+		thread_pool_executor& operator=(const thread_pool_executor&) = delete;
+
+		~thread_pool_executor()
+		{
+			for (std::jthread& worker : workers_)
+			{
+				worker.request_stop();
+			}
+
+			workers_.clear();
+
+			while (!ready_.empty())
+			{
+				std::coroutine_handle<> handle = ready_.front();
+				ready_.pop_front();
+				handle.destroy();
+			}
+		}
+
+		void schedule(std::coroutine_handle<> handle)
+		{
+			{
+				std::scoped_lock lock{ mutex_ };
+				ready_.push_back(handle);
+			}
+
+			ready_cv_.notify_one();
+		}
+
+	private:
+		void work_(std::stop_token stop)
+		{
+			while (true)
+			{
+				std::coroutine_handle<> handle;
+				{
+					std::unique_lock lock{ mutex_ };
+					ready_cv_.wait(lock, stop, [this] { return !ready_.empty(); });
+
+					if (stop.stop_requested() || ready_.empty())
+					{
+						return;
+					}
+
+					handle = ready_.front();
+					ready_.pop_front();
+				}
+
+				handle.resume();
+			}
+		}
+
+		std::mutex mutex_;
+		std::condition_variable_any ready_cv_;
+		list<std::coroutine_handle<>> ready_;
+		std::vector<std::jthread> workers_;
+	};
+
+	class detached_task
+	{
+	public:
+		struct promise_type
+		{
+			detached_task get_return_object() noexcept
+			{
+				return detached_task{ std::coroutine_handle<promise_type>::from_promise(*this) };
+			}
+
+			std::suspend_always initial_suspend() noexcept
+			{
+				return {};
+			}
+
+			std::suspend_never final_suspend() noexcept
+			{
+				return {};
+			}
+
+			void return_void() noexcept {}
+
+			void unhandled_exception() noexcept
+			{
+				std::terminate();
+			}
+		};
+
+		detached_task(detached_task&& other) noexcept
+			: handle_{ std::exchange(other.handle_, {}) }
+		{}
+
+		detached_task& operator=(detached_task&&) = delete;
+
+		~detached_task()
+		{
+			if (handle_)
+			{
+				handle_.destroy();
+			}
+		}
+
+		void start(executor_ref executor) &&
+		{
+			executor.schedule(std::exchange(handle_, {}));
+		}
+
+	private:
+		explicit detached_task(std::coroutine_handle<promise_type> handle) noexcept
+			: handle_{ handle }
+		{}
+
+		std::coroutine_handle<promise_type> handle_;
+	};
+
+	inline void spawn(executor_ref executor, detached_task task)
+	{
+		std::move(task).start(executor);
+	}
+
+	template <typename T, typename Allocator = std::allocator<T>>
+	class channel
+	{
+	public:
+		using value_type = T;
+		using allocator_type = Allocator;
+		using list_type = list<T, Allocator>;
+		using size_type = std::size_t;
+
+		static constexpr size_type unbounded = std::numeric_limits<size_type>::max();
+
+	private:
+		struct waiter_
+		{
+			explicit waiter_(channel& ch)
+				: channel_{ &ch }
+				, slot_(ch.items_.get_allocator())
+			{}
+
+			waiter_(const waiter_&) = delete;
+			waiter_& operator=(const waiter_&) = delete;
+
+			channel* channel_;
+			list_type slot_;
+			std::coroutine_handle<> handle_;
+			waiter_* next_ = nullptr;
+			size_type want_ = 1;
+			bool accepted_ = false;
+		};
+
+		struct waiter_queue_
+		{
+			void push(waiter_* waiter) noexcept
+			{
+				waiter->next_ = nullptr;
+				(tail_ ? tail_->next_ : head_) = waiter;
+				tail_ = waiter;
+			}
+
+			waiter_* pop() noexcept
+			{
+				waiter_* waiter = head_;
+				head_ = waiter->next_;
+
+				if (!head_)
+				{
+					tail_ = nullptr;
+				}
+
+				return waiter;
+			}
+
+			bool empty() const noexcept
+			{
+				return head_ == nullptr;
+			}
+
+			waiter_* head_ = nullptr;
+			waiter_* tail_ = nullptr;
+		};
+
+		struct pop_base_ : waiter_
+		{
+			using waiter_::waiter_;
+
+			bool await_ready() const noexcept
+			{
+				return false;
+			}
+
+			bool await_suspend(std::coroutine_handle<> handle)
+			{
+				channel& ch = *this->channel_;
+				waiter_* wake = nullptr;
+				{
+					std::scoped_lock lock{ ch.mutex_ };
+
+					if (ch.items_.empty() && !ch.closed_)
+					{
+						this->handle_ = handle;
+						ch.poppers_.push(this);
+						return true;
+					}
+
+					wake = ch.take_(this->slot_, this->want_);
+				}
+
+				ch.wake_(wake);
+				return false;
+			}
+		};
+
+	public:
+		class push_awaiter : private waiter_
+		{
+			friend class channel;
+
+		public:
+			bool await_ready() const noexcept
+			{
+				return false;
+			}
+
+			bool await_suspend(std::coroutine_handle<> handle)
+			{
+				channel& ch = *this->channel_;
+				waiter_* popper = nullptr;
+				{
+					std::scoped_lock lock{ ch.mutex_ };
+
+					if (ch.closed_)
+					{
+						return false;
+					}
+
+					this->accepted_ = ch.offer_(this->slot_, popper);
+
+					if (!this->accepted_)
+					{
+						this->handle_ = handle;
+						ch.pushers_.push(this);
+						return true;
+					}
+				}
+
+				ch.wake_(popper);
+				return false;
+			}
+
+			bool await_resume() const noexcept
+			{
+				return this->accepted_;
+			}
+
+		private:
+			push_awaiter(channel& ch, T&& value)
+				: waiter_(ch)
+			{
+				this->slot_.push_back(std::move(value));
+			}
+		};
+
+		class pop_awaiter : private pop_base_
+		{
+			friend class channel;
+
+		public:
+			using pop_base_::await_ready;
+			using pop_base_::await_suspend;
+
+			std::optional<T> await_resume()
+			{
+				if (this->slot_.empty())
+				{
+					return std::nullopt;
+				}
+
+				return std::optional<T>(std::move(this->slot_.front()));
+			}
+
+		private:
+			explicit pop_awaiter(channel& ch)
+				: pop_base_(ch)
+			{}
+		};
+
+		class pop_batch_awaiter : private pop_base_
+		{
+			friend class channel;
+
+		public:
+			using pop_base_::await_ready;
+			using pop_base_::await_suspend;
+
+			list_type await_resume()
+			{
+				channel& ch = *this->channel_;
+
+				if (!this->slot_.empty() && this->slot_.size() < this->want_)
+				{
+					waiter_* wake = nullptr;
+					{
+						std::scoped_lock lock{ ch.mutex_ };
+						wake = ch.take_(this->slot_, this->want_ - this->slot_.size());
+					}
+
+					ch.wake_(wake);
+				}
+
+				return std::move(this->slot_);
+			}
+
+		private:
+			pop_batch_awaiter(channel& ch, size_type max_count)
+				: pop_base_(ch)
+			{
+				this->want_ = std::max<size_type>(max_count, 1);
+			}
+		};
+
+		explicit channel(executor_ref executor, size_type capacity = unbounded, const Allocator& alloc = Allocator())
+			: executor_{ executor }
+			, items_(alloc)
+			, capacity_{ std::max<size_type>(capacity, 1) }
+		{}
+
+		channel(const channel&) = delete;
+		channel& operator=(const channel&) = delete;
+
+		[[nodiscard]]
+		push_awaiter push(T value)
+		{
+			return push_awaiter(*this, std::move(value));
+		}
+
+		[[nodiscard]]
+		pop_awaiter pop()
+		{
+			return pop_awaiter(*this);
+		}
+
+		[[nodiscard]]
+		pop_batch_awaiter pop_batch(size_type max_count)
+		{
+			return pop_batch_awaiter(*this, max_count);
+		}
+
+		bool try_push(T value)
+		{
+			list_type slot(items_.get_allocator());
+			slot.push_back(std::move(value));
+			waiter_* popper = nullptr;
+			{
+				std::scoped_lock lock{ mutex_ };
+
+				if (closed_ || !this->offer_(slot, popper))
+				{
+					return false;
+				}
+			}
+
+			this->wake_(popper);
+			return true;
+		}
+
+		std::optional<T> try_pop()
+		{
+			list_type slot(items_.get_allocator());
+			waiter_* wake = nullptr;
+			{
+				std::scoped_lock lock{ mutex_ };
+				wake = this->take_(slot, 1);
+			}
+
+			this->wake_(wake);
+
+			if (slot.empty())
+			{
+				return std::nullopt;
+			}
+
+			return std::optional<T>(std::move(slot.front()));
+		}
+
+		void close()
+		{
+			waiter_* wake = nullptr;
+			{
+				std::scoped_lock lock{ mutex_ };
+				closed_ = true;
+
+				for (waiter_queue_* queue : { &poppers_, &pushers_ })
+				{
+					while (!queue->empty())
+					{
+						waiter_* waiter = queue->pop();
+						waiter->accepted_ = false;
+						waiter->next_ = wake;
+						wake = waiter;
+					}
+				}
+			}
+
+			this->wake_(wake);
+		}
+
+		[[nodiscard]]
+		bool closed() const
+		{
+			std::scoped_lock lock{ mutex_ };
+			return closed_;
+		}
+
+		[[nodiscard]]
+		size_type size() const
+		{
+			std::scoped_lock lock{ mutex_ };
+			return items_.size();
+		}
+
+		[[nodiscard]]
+		size_type capacity() const noexcept
+		{
+			return capacity_;
+		}
+
+	private:
+		bool offer_(list_type& slot, waiter_*& popper)
+		{
+			if (!poppers_.empty())
+			{
+				popper = poppers_.pop();
+				popper->slot_.splice(popper->slot_.end(), slot);
+				popper->next_ = nullptr;
+				return true;
+			}
+
+			if (items_.size() < capacity_)
+			{
+				items_.splice(items_.end(), slot);
+				return true;
+			}
+
+			return false;
+		}
+
+		waiter_* take_(list_type& slot, size_type count)
+		{
+			if (count >= items_.size())
+			{
+				slot.splice(slot.end(), items_);
+			}
+			else
+			{
+				slot.splice(slot.end(), items_, items_.begin(), std::ranges::next(items_.begin(), count));
+			}
+
+			waiter_* wake = nullptr;
+
+			while (items_.size() < capacity_ && !pushers_.empty())
+			{
+				waiter_* pusher = pushers_.pop();
+				items_.splice(items_.end(), pusher->slot_);
+				pusher->accepted_ = true;
+				pusher->next_ = wake;
+				wake = pusher;
+			}
+
+			return wake;
+		}
+
+		void wake_(waiter_* waiter) const
+		{
+			while (waiter)
+			{
+				waiter_* next = waiter->next_;
+				executor_.schedule(waiter->handle_);
+				waiter = next;
+			}
+		}
+
+		executor_ref executor_;
+		mutable std::mutex mutex_;
+		list_type items_;
+		waiter_queue_ poppers_;
+		waiter_queue_ pushers_;
+		size_type capacity_;
+		bool closed_ = false;
+	};
+}
+
+#endif // CONSTEXPR_LIST_CHANNEL
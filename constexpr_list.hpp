@@ -2,20 +2,284 @@
 #define CONSTEXPR_LIST
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <ranges>
 #include <concepts>
 #include <type_traits>
 #include <memory>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 namespace constexpr_list
 {
 	namespace detail
 	{
+		template <typename Pointer, typename T>
+		constexpr Pointer pointer_to(T& ref) noexcept
+		{
+			if constexpr (std::is_pointer_v<Pointer>)
+			{
+				return std::addressof(ref);
+			}
+			else
+			{
+				return Pointer::pointer_to(ref);
+			}
+		}
+
+		template <typename T>
+		constexpr void store_bytes(std::byte* out, const T& value) noexcept
+		{
+			std::ranges::copy(std::bit_cast<std::array<std::byte, sizeof(T)>>(value), out);
+		}
+
+		template <typename T>
+		constexpr T load_bytes(const std::byte* in) noexcept
+		{
+			std::array<std::byte, sizeof(T)> bytes;
+			std::ranges::copy_n(in, sizeof(T), bytes.begin());
+			return std::bit_cast<T>(bytes);
+		}
+
+		template <typename URBG>
+		constexpr std::size_t uniform_index(URBG& g, std::size_t bound)
+		{
+			constexpr std::uint64_t span = static_cast<std::uint64_t>(URBG::max() - URBG::min());
+
+			for (;;)
+			{
+				std::uint64_t range = span;
+				std::uint64_t draw = static_cast<std::uint64_t>(g() - URBG::min());
+
+				while (range < bound - 1)
+				{
+					draw = draw * (span + 1) + static_cast<std::uint64_t>(g() - URBG::min());
+					range = range * (span + 1) + span;
+				}
+
+				if (draw <= range - (range % bound + 1) % bound)
+				{
+					return static_cast<std::size_t>(draw % bound);
+				}
+			}
+		}
+
+		template <typename Alloc>
+		concept skips_deallocation = requires { typename Alloc::skips_deallocation; }
+			&& Alloc::skips_deallocation::value;
+
+		template <typename T>
+		concept block_comparable = std::is_arithmetic_v<T> && !std::same_as<T, bool>;
+
+		inline constexpr std::size_t gather_width = 16;
+
+		template <block_comparable T>
+		inline std::uint32_t equal_mask(const T* lhs, const T* rhs) noexcept
+		{
+#if defined(__AVX2__)
+			if constexpr (std::is_floating_point_v<T> && sizeof(T) == 4)
+			{
+				const __m256 low = _mm256_cmp_ps(_mm256_loadu_ps(lhs), _mm256_loadu_ps(rhs), _CMP_EQ_OQ);
+				const __m256 high = _mm256_cmp_ps(_mm256_loadu_ps(lhs + 8), _mm256_loadu_ps(rhs + 8), _CMP_EQ_OQ);
+				return static_cast<std::uint32_t>(_mm256_movemask_ps(low) | (_mm256_movemask_ps(high) << 8));
+			}
+
+			if constexpr (std::is_floating_point_v<T> && sizeof(T) == 8)
+			{
+				std::uint32_t mask = 0;
+
+				for (std::size_t i = 0; i < gather_width; i += 4)
+				{
+					const __m256d eq = _mm256_cmp_pd(_mm256_loadu_pd(lhs + i), _mm256_loadu_pd(rhs + i), _CMP_EQ_OQ);
+					mask |= static_cast<std::uint32_t>(_mm256_movemask_pd(eq)) << i;
+				}
+
+				return mask;
+			}
+
+			if constexpr (std::is_integral_v<T> && sizeof(T) == 4)
+			{
+				const auto* l = reinterpret_cast<const __m256i*>(lhs);
+				const auto* r = reinterpret_cast<const __m256i*>(rhs);
+				const __m256i low = _mm256_cmpeq_epi32(_mm256_loadu_si256(l), _mm256_loadu_si256(r));
+				const __m256i high = _mm256_cmpeq_epi32(_mm256_loadu_si256(l + 1), _mm256_loadu_si256(r + 1));
+				return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(low))
+					| (_mm256_movemask_ps(_mm256_castsi256_ps(high)) << 8));
+			}
+
+			if constexpr (std::is_integral_v<T> && sizeof(T) == 8)
+			{
+				const auto* l = reinterpret_cast<const __m256i*>(lhs);
+				const auto* r = reinterpret_cast<const __m256i*>(rhs);
+				std::uint32_t mask = 0;
+
+				for (std::size_t i = 0; i < gather_width / 4; ++i)
+				{
+					const __m256i eq = _mm256_cmpeq_epi64(_mm256_loadu_si256(l + i), _mm256_loadu_si256(r + i));
+					mask |= static_cast<std::uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(eq))) << (i * 4);
+				}
+
+				return mask;
+			}
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+			if constexpr (std::is_floating_point_v<T> && sizeof(T) == 4)
+			{
+				std::uint32_t mask = 0;
+
+				for (std::size_t i = 0; i < gather_width; i += 4)
+				{
+					const __m128 eq = _mm_cmpeq_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i));
+					mask |= static_cast<std::uint32_t>(_mm_movemask_ps(eq)) << i;
+				}
+
+				return mask;
+			}
+
+			if constexpr (std::is_floating_point_v<T> && sizeof(T) == 8)
+			{
+				std::uint32_t mask = 0;
+
+				for (std::size_t i = 0; i < gather_width; i += 2)
+				{
+					const __m128d eq = _mm_cmpeq_pd(_mm_loadu_pd(lhs + i), _mm_loadu_pd(rhs + i));
+					mask |= static_cast<std::uint32_t>(_mm_movemask_pd(eq)) << i;
+				}
+
+				return mask;
+			}
+
+			if constexpr (std::is_integral_v<T>)
+			{
+				const auto* l = reinterpret_cast<const __m128i*>(lhs);
+				const auto* r = reinterpret_cast<const __m128i*>(rhs);
+				constexpr std::size_t lanes = 16 / sizeof(T);
+				std::uint32_t mask = 0;
+
+				for (std::size_t i = 0; i < gather_width / lanes; ++i)
+				{
+					const __m128i a = _mm_loadu_si128(l + i);
+					const __m128i b = _mm_loadu_si128(r + i);
+
+					if constexpr (sizeof(T) == 1)
+					{
+						mask |= static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+					}
+					else if constexpr (sizeof(T) == 2)
+					{
+						const __m128i eq = _mm_cmpeq_epi16(a, b);
+						mask |= static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(eq, eq)) & 0xFF) << (i * lanes);
+					}
+					else if constexpr (sizeof(T) == 4)
+					{
+						const __m128i eq = _mm_cmpeq_epi32(a, b);
+						mask |= static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(eq))) << (i * lanes);
+					}
+					else
+					{
+						const __m128i eq32 = _mm_cmpeq_epi32(a, b);
+						const __m128i eq = _mm_and_si128(eq32, _mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1)));
+						mask |= static_cast<std::uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(eq))) << (i * lanes);
+					}
+				}
+
+				return mask;
+			}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+			if constexpr (sizeof(T) == 4)
+			{
+				constexpr std::uint32_t weights[4] = { 1, 2, 4, 8 };
+				const uint32x4_t bits = vld1q_u32(weights);
+				std::uint32_t mask = 0;
+
+				for (std::size_t i = 0; i < gather_width; i += 4)
+				{
+					uint32x4_t eq;
+
+					if constexpr (std::is_floating_point_v<T>)
+					{
+						eq = vceqq_f32(vld1q_f32(lhs + i), vld1q_f32(rhs + i));
+					}
+					else
+					{
+						eq = vceqq_u32(vld1q_u32(reinterpret_cast<const std::uint32_t*>(lhs + i)),
+							vld1q_u32(reinterpret_cast<const std::uint32_t*>(rhs + i)));
+					}
+
+					mask |= vaddvq_u32(vandq_u32(eq, bits)) << i;
+				}
+
+				return mask;
+			}
+
+			if constexpr (sizeof(T) == 8)
+			{
+				constexpr std::uint64_t weights[2] = { 1, 2 };
+				const uint64x2_t bits = vld1q_u64(weights);
+				std::uint32_t mask = 0;
+
+				for (std::size_t i = 0; i < gather_width; i += 2)
+				{
+					uint64x2_t eq;
+
+					if constexpr (std::is_floating_point_v<T>)
+					{
+						eq = vceqq_f64(vld1q_f64(lhs + i), vld1q_f64(rhs + i));
+					}
+					else
+					{
+						eq = vceqq_u64(vld1q_u64(reinterpret_cast<const std::uint64_t*>(lhs + i)),
+							vld1q_u64(reinterpret_cast<const std::uint64_t*>(rhs + i)));
+					}
+
+					mask |= static_cast<std::uint32_t>(vaddvq_u64(vandq_u64(eq, bits))) << i;
+				}
+
+				return mask;
+			}
+#endif
+			std::uint32_t mask = 0;
+
+			for (std::size_t i = 0; i < gather_width; ++i)
+			{
+				mask |= static_cast<std::uint32_t>(lhs[i] == rhs[i]) << i;
+			}
+
+			return mask;
+		}
+
 		template <typename R, typename T>
 		concept container_compatible_range =
 			std::ranges::input_range<R> &&
 			std::convertible_to<std::ranges::range_reference_t<R>, T>;
 
+		template <typename Policy>
+		struct execution_traits
+		{
+			static constexpr bool is_policy = false;
+			static constexpr bool parallel = false;
+		};
+
+		template <typename Policy>
+		concept execution_policy = execution_traits<std::remove_cvref_t<Policy>>::is_policy;
+
+		template <typename R, typename T>
+		concept parallel_buildable_range =
+			container_compatible_range<R, T> &&
+			std::ranges::random_access_range<R> &&
+			std::ranges::sized_range<R>;
+
 		template <typename B>
 		concept boolean_testable =
 			std::convertible_to<B, bool>&&
@@ -59,16 +323,160 @@ namespace constexpr_list
 		template <typename T, typename U = T>
 		using synth_three_way_result =
 			decltype(synth_three_way(std::declval<T&>(), std::declval<U&>()));
+
+		struct stats_policy_tag {};
+		struct size_policy_tag {};
+		struct sentinel_policy_tag {};
+
+		template <typename P>
+		concept list_policy = requires
+		{
+			typename P::policy_category;
+		};
+
+		template <typename Category, typename Default, typename ... Policies>
+		struct select_policy
+		{
+			using type = Default;
+		};
+
+		template <typename Category, typename Default, typename P, typename ... Policies>
+		struct select_policy<Category, Default, P, Policies...>
+			: std::conditional_t<std::same_as<typename P::policy_category, Category>,
+				std::type_identity<P>,
+				select_policy<Category, Default, Policies...>>
+		{};
+
+		template <typename List>
+		struct list_stream;
+
+		template <typename List>
+		struct parallel_builder;
 	}
 
+	struct no_stats
+	{
+		using policy_category = detail::stats_policy_tag;
+
+		constexpr void on_visit(std::size_t) noexcept {}
+		constexpr void on_relink(std::size_t) noexcept {}
+		constexpr void on_compare() noexcept {}
+		constexpr void on_erase() noexcept {}
+		constexpr void on_size(std::size_t) noexcept {}
+	};
+
+	struct operation_stats
+	{
+		using policy_category = detail::stats_policy_tag;
+
+		std::size_t nodes_visited = 0;
+		std::size_t relinks = 0;
+		std::size_t comparisons = 0;
+		std::size_t erasures = 0;
+		std::size_t peak_size = 0;
+
+		constexpr void on_visit(std::size_t count) noexcept
+		{
+			nodes_visited += count;
+		}
+
+		constexpr void on_relink(std::size_t count) noexcept
+		{
+			relinks += count;
+		}
+
+		constexpr void on_compare() noexcept
+		{
+			++comparisons;
+		}
+
+		constexpr void on_erase() noexcept
+		{
+			++erasures;
+		}
+
+		constexpr void on_size(std::size_t size) noexcept
+		{
+			peak_size = std::max(peak_size, size);
+		}
+
+		constexpr void reset() noexcept
+		{
+			*this = operation_stats{};
+		}
+	};
+
+	struct cached_size
+	{
+		using policy_category = detail::size_policy_tag;
+	};
+
+	struct lazy_size
+	{
+		using policy_category = detail::size_policy_tag;
+	};
+
+	struct embedded_sentinel
+	{
+		using policy_category = detail::sentinel_policy_tag;
+	};
+
+	struct heap_sentinel
+	{
+		using policy_category = detail::sentinel_policy_tag;
+	};
+
+	struct node_layout
+	{
+		static constexpr std::size_t cache_line = 64;
+		static constexpr std::size_t page = 4096;
+		static constexpr std::size_t window = 1000;
+		static constexpr std::size_t stride_buckets = 48;
+
+		std::size_t nodes = 0;
+		std::size_t node_bytes = 0;
+		std::size_t overhead_bytes = 0;
+		std::size_t backward_strides = 0;
+		std::array<std::size_t, stride_buckets> stride_histogram{};
+		double same_cache_line = 0;
+		double same_page = 0;
+		double pages_per_window = 0;
+	};
+
+	template <typename Allocator>
+	struct is_concurrent_allocator : std::bool_constant<
+		std::is_empty_v<Allocator> && std::allocator_traits<Allocator>::is_always_equal::value>
+	{};
+
+	template <typename Allocator>
+	inline constexpr bool is_concurrent_allocator_v = is_concurrent_allocator<Allocator>::value;
+
 	template<
 		typename T,
-		typename Allocator = std::allocator<T>
+		typename Allocator = std::allocator<T>,
+		typename ... Policies
 	>
 	class list
 	{
 		template <bool Const>
 		struct iterator_base;
+		struct links_;
+		struct node_;
+
+		template <typename List>
+		friend struct detail::list_stream;
+
+		template <typename List>
+		friend struct detail::parallel_builder;
+
+		using node_allocator = typename
+			std::allocator_traits<Allocator>::template rebind_alloc<node_>;
+		using traits = typename std::allocator_traits<node_allocator>;
+		using node_pointer = typename traits::pointer;
+		using link_pointer = typename std::pointer_traits<
+			typename std::allocator_traits<Allocator>::void_pointer>::template rebind<links_>;
+
+		static_assert((detail::list_policy<Policies> && ...), "unrecognized list policy");
 
 		static_assert(std::copy_constructible<T>, "T is required to be copy-constructible");
 		static_assert(!std::is_reference_v<T>, "T cannot be a reference type");
@@ -88,8 +496,65 @@ namespace constexpr_list
 		using const_iterator = iterator_base<true>;
 		using reverse_iterator = std::reverse_iterator<iterator>;
 		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+		using stats_type = typename detail::select_policy<detail::stats_policy_tag, no_stats, Policies...>::type;
+		using size_policy = typename detail::select_policy<detail::size_policy_tag, cached_size, Policies...>::type;
+		using sentinel_policy = typename detail::select_policy<detail::sentinel_policy_tag, embedded_sentinel, Policies...>::type;
+
+		class reclaimer
+		{
+			friend class list;
+
+		public:
+			reclaimer(const reclaimer&) = delete;
+			reclaimer& operator=(const reclaimer&) = delete;
+
+			constexpr reclaimer(reclaimer&& other) noexcept
+				: head_{ std::exchange(other.head_, nullptr) }
+				, alloc_(other.alloc_)
+			{}
+
+			constexpr ~reclaimer()
+			{
+				this->reclaim(static_cast<size_type>(-1));
+			}
+
+			constexpr size_type reclaim(size_type budget)
+			{
+				size_type reclaimed = 0;
+
+				while (head_ != nullptr && reclaimed < budget)
+				{
+					link_pointer next = head_->next_;
+					list::free_node_(alloc_, head_);
+					head_ = next;
+					++reclaimed;
+				}
+
+				return reclaimed;
+			}
+
+			[[nodiscard]]
+			constexpr bool empty() const noexcept
+			{
+				return head_ == nullptr;
+			}
+
+		private:
+			constexpr reclaimer(link_pointer head, const node_allocator& alloc) noexcept
+				: head_{ head }
+				, alloc_(alloc)
+			{}
+
+			link_pointer head_;
+			[[no_unique_address]] node_allocator alloc_;
+		};
 
-		constexpr list() noexcept = default;
+		static constexpr bool trivially_relocatable = std::same_as<sentinel_policy, heap_sentinel>
+			&& (std::is_empty_v<node_allocator> || std::is_trivially_copyable_v<node_allocator>)
+			&& std::is_trivially_copyable_v<link_pointer>
+			&& std::is_trivially_copyable_v<stats_type>;
+
+		constexpr list() noexcept(!heap_sentinel_) = default;
 
 		explicit constexpr list(const Allocator& alloc)
 			: alloc_(std::allocator_traits<allocator_type>::select_on_container_copy_construction(alloc))
@@ -142,37 +607,17 @@ namespace constexpr_list
 		}
 
 		constexpr list(list&& other)
-			noexcept(std::allocator_traits<allocator_type>::is_always_equal::value)
-			: ptrs_{ other.ptrs_.next_, other.ptrs_.prev_ }
-			, size_{ other.size_ }
-			, alloc_( std::move(other.alloc_) )
+			noexcept(std::allocator_traits<allocator_type>::is_always_equal::value && !heap_sentinel_)
+			: alloc_( std::move(other.alloc_) )
 		{
-			if (size_ == 0) [[unlikely]]
-			{
-				ptrs_ = links_{ &ptrs_, &ptrs_ };
-			}
-
-			other.ptrs_.next_->prev_ = &ptrs_;
-			other.ptrs_.prev_->next_ = &ptrs_;
-			other.size_ = 0;
-			other.ptrs_ = links_{ &other.ptrs_, &other.ptrs_ };
+			this->steal_chain_(other);
 		}
 
-		constexpr list(list&& other, const allocator_type& alloc) noexcept
+		constexpr list(list&& other, const allocator_type& alloc) noexcept(!heap_sentinel_)
 			requires(std::allocator_traits<allocator_type>::is_always_equal::value)
-			: ptrs_{ other.ptrs_.next_, other.ptrs_.prev_ }
-			, size_{ other.size_ }
-			, alloc_(std::allocator_traits<allocator_type>::select_on_container_copy_construction(alloc))
+			: alloc_(std::allocator_traits<allocator_type>::select_on_container_copy_construction(alloc))
 		{
-			if (size_ == 0) [[unlikely]]
-			{
-				ptrs_ = links_{ &ptrs_, &ptrs_ };
-			}
-
-			other.ptrs_.next_->prev_ = &ptrs_;
-			other.ptrs_.prev_->next_ = &ptrs_;
-			other.size_ = 0;
-			other.ptrs_ = links_{ &other.ptrs_, &other.ptrs_ };
+			this->steal_chain_(other);
 		}
 
 		constexpr list(list&& other, const allocator_type& alloc)
@@ -185,21 +630,7 @@ namespace constexpr_list
 			}
 			else
 			{
-				size_ = other.size_;
-
-				if (size_ == 0) [[unlikely]]
-				{
-					ptrs_ = links_{ &ptrs_, &ptrs_ };
-				}
-				else
-				{
-					ptrs_ = { other.ptrs_.next_, other.ptrs_.prev_ };
-				}
-
-				other.ptrs_.next_->prev_ = &ptrs_;
-				other.ptrs_.prev_->next_ = &ptrs_;
-				other.size_ = 0;
-				other.ptrs_ = links_{ &other.ptrs_, &other.ptrs_ };
+				this->steal_chain_(other);
 			}
 		}
 
@@ -229,16 +660,28 @@ namespace constexpr_list
 			}
 		}
 
+		template <detail::execution_policy ExecutionPolicy, detail::parallel_buildable_range<T> R>
+		constexpr list(std::from_range_t, ExecutionPolicy&& policy, R&& rg,
+			const allocator_type& alloc = allocator_type())
+			: alloc_(std::allocator_traits<allocator_type>::select_on_container_copy_construction(alloc))
+		{
+			this->append_range(std::forward<ExecutionPolicy>(policy), std::forward<R>(rg));
+		}
+
 		constexpr list& operator=(const list& other)
 		{
 			if constexpr (std::allocator_traits<node_allocator>::propagate_on_container_copy_assignment::value)
 			{
 				if (alloc_ != other.alloc_)
 				{
-					this->reset();
+					this->clear();
+					this->replace_allocator_(
+						std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.alloc_));
+				}
+				else
+				{
+					alloc_ = std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.alloc_);
 				}
-
-				alloc_ = std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.alloc_);
 			}
 
 			const_iterator mid_point = std::ranges::next(other.begin(), this->size(), other.end());
@@ -281,7 +724,8 @@ namespace constexpr_list
 				if (alloc_ != other.alloc_)
 				{
 					this->clear();
-					alloc_ = std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.alloc_);
+					this->replace_allocator_(
+						std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.alloc_));
 					for (auto& value : other)
 					{
 						this->push_back(std::move(value));
@@ -303,8 +747,8 @@ namespace constexpr_list
 			}
 			else
 			{
-				ptrs_ = std::exchange(other.ptrs_, links_{});
-				size_ = std::exchange(other.size_, 0);
+				this->clear();
+				this->steal_chain_(other);
 			}
 
 			return *this;
@@ -407,6 +851,27 @@ namespace constexpr_list
 			}
 		}
 
+		template <detail::execution_policy ExecutionPolicy, detail::parallel_buildable_range<T> R>
+		constexpr void append_range(ExecutionPolicy&&, R&& rg)
+		{
+			if consteval
+			{
+				this->append_range(std::forward<R>(rg));
+			}
+			else
+			{
+				if constexpr (detail::execution_traits<std::remove_cvref_t<ExecutionPolicy>>::parallel
+					&& is_concurrent_allocator_v<Allocator>)
+				{
+					detail::parallel_builder<list>::append(*this, std::ranges::begin(rg), static_cast<size_type>(std::ranges::size(rg)));
+				}
+				else
+				{
+					this->append_range(std::forward<R>(rg));
+				}
+			}
+		}
+
 		template <detail::container_compatible_range<T> R>
 		constexpr void prepend_range(R&& rg)
 		{
@@ -421,7 +886,7 @@ namespace constexpr_list
 
 			if (begin == end)
 			{
-				return iterator{ const_cast<links_*>(pos.ptrs_) };
+				return iterator{ pos.ptrs_ };
 			}
 			
 			auto first = this->emplace(pos, *begin);
@@ -444,15 +909,9 @@ namespace constexpr_list
 		template <typename ... Args> requires std::constructible_from<T, Args...>
 		constexpr iterator emplace(const_iterator pos, Args&& ... args)
 		{
-			node_* new_node = traits::allocate(alloc_, 1);
-			links_* prev = const_cast<links_*>(pos.ptrs_)->prev_;
-			traits::construct(alloc_, new_node, std::in_place, std::forward<Args>(args)...);
-			prev->next_ = static_cast<links_*>(new_node);
-			new_node->prev_ = prev;
-			new_node->next_ = const_cast<links_*>(pos.ptrs_);
-			const_cast<links_*>(pos.ptrs_)->prev_ = static_cast<links_*>(new_node);
-			++size_;
-			return iterator{ static_cast<links_*>(new_node) };
+			node_pointer new_node = traits::allocate(alloc_, 1);
+			traits::construct(alloc_, std::to_address(new_node), std::in_place, std::forward<Args>(args)...);
+			return this->insert_node_(pos, link_of_(new_node));
 		}
 
 		constexpr iterator insert(const_iterator pos, T&& value)
@@ -464,7 +923,7 @@ namespace constexpr_list
 		{
 			if (count == 0)
 			{
-				return pos;
+				return iterator{ pos.ptrs_ };
 			}
 
 			auto it = this->insert(pos, value);
@@ -484,7 +943,7 @@ namespace constexpr_list
 		{
 			if (first == last)
 			{
-				return iterator{ const_cast<links_*>(pos.ptrs_) };
+				return iterator{ pos.ptrs_ };
 			}
 
 			auto it = this->insert(pos, *first);
@@ -529,14 +988,10 @@ namespace constexpr_list
 
 		constexpr void pop_back()
 		{
-			node_* removed = static_cast<node_*>(ptrs_.prev_);
-			removed->prev_->next_ = &ptrs_;
-			ptrs_.prev_ = removed->prev_;
-
-			std::destroy_at(std::addressof(static_cast<node_*>(removed)->storage_.value_));
-			traits::destroy(alloc_, static_cast<node_*>(removed));
-			traits::deallocate(alloc_, static_cast<node_*>(removed), 1);
-			--size_;
+			link_pointer removed = this->anchor_().prev_;
+			unlink_chain_(removed, removed);
+			this->destroy_node_(removed);
+			this->shrink_size_(1);
 		}
 
 		constexpr void push_front(const T& value)
@@ -552,19 +1007,15 @@ namespace constexpr_list
 		template<typename ... Args>
 		constexpr reference emplace_front(Args&& ... args)
 		{
-			this->emplace(this->begin(), std::forward<Args>(args)...);
+			return *this->emplace(this->begin(), std::forward<Args>(args)...);
 		}
 
 		constexpr void pop_front()
 		{
-			node_* removed = static_cast<node_*>(ptrs_.next_);
-			ptrs_.next_ = removed->next_;
-			removed->next_->prev_ = &ptrs_;
-
-			std::destroy_at(std::addressof(static_cast<node_*>(removed)->storage_.value_));
-			traits::destroy(alloc_, static_cast<node_*>(removed));
-			traits::deallocate(alloc_, static_cast<node_*>(removed), 1);
-			--size_;
+			link_pointer removed = this->anchor_().next_;
+			unlink_chain_(removed, removed);
+			this->destroy_node_(removed);
+			this->shrink_size_(1);
 		}
 
 		constexpr iterator erase(const_iterator pos)
@@ -574,17 +1025,13 @@ namespace constexpr_list
 				return this->end();
 			}
 
-			node_* removed = static_cast<node_*>(const_cast<links_*>(pos.ptrs_));
-			links_* prev = removed->prev_;
-			prev->next_ = removed->next_;
-			removed->next_->prev_ = prev;
-
-			std::destroy_at(std::addressof(static_cast<node_*>(removed)->storage_.value_));
-			traits::destroy(alloc_, static_cast<node_*>(removed));
-			traits::deallocate(alloc_, static_cast<node_*>(removed), 1);
-			--size_;
+			link_pointer removed = pos.ptrs_;
+			link_pointer next = removed->next_;
+			unlink_chain_(removed, removed);
+			this->destroy_node_(removed);
+			this->shrink_size_(1);
 
-			return iterator{ prev->next_ };
+			return iterator{ next };
 		}
 
 		constexpr iterator erase(const_iterator first, const_iterator last)
@@ -597,20 +1044,30 @@ namespace constexpr_list
 				} while (first != last);
 			}
 
-			return iterator(const_cast<links_*>(last.ptrs_));
+			return iterator{ last.ptrs_ };
 		}
 
 		template <typename U> requires std::equality_comparable_with<const T&, const U&>
 		constexpr size_type remove(const U& value)
 		{
+			if constexpr (block_searchable_<U>)
+			{
+				if !consteval
+				{
+					return this->remove_blocks_(value);
+				}
+			}
+
 			auto it = this->cbegin();
-			const size_type old_size = this->size();
+			size_type removed = 0;
 
 			while (it != this->cend())
 			{
+				stats_.on_visit(1);
 				if (*it == value)
 				{
 					it = this->erase(it);
+					++removed;
 				}
 				else
 				{
@@ -618,20 +1075,59 @@ namespace constexpr_list
 				}
 			}
 
-			return old_size - this->size();
+			return removed;
+		}
+
+		template <typename U> requires std::equality_comparable_with<const T&, const U&>
+		[[nodiscard]]
+		constexpr size_type count(const U& value) const
+		{
+			if constexpr (block_searchable_<U>)
+			{
+				if !consteval
+				{
+					return this->count_blocks_(value);
+				}
+			}
+
+			return static_cast<size_type>(std::ranges::count(*this, value));
+		}
+
+		template <typename U> requires std::equality_comparable_with<const T&, const U&>
+		[[nodiscard]]
+		constexpr iterator find(const U& value)
+		{
+			return iterator{ std::as_const(*this).find(value).ptrs_ };
+		}
+
+		template <typename U> requires std::equality_comparable_with<const T&, const U&>
+		[[nodiscard]]
+		constexpr const_iterator find(const U& value) const
+		{
+			if constexpr (block_searchable_<U>)
+			{
+				if !consteval
+				{
+					return const_iterator{ this->find_blocks_(value) };
+				}
+			}
+
+			return std::ranges::find(*this, value);
 		}
 
 		template <typename UnaryPredicate>
 		constexpr size_type remove_if(UnaryPredicate p)
 		{
 			auto it = this->cbegin();
-			const size_type old_size = this->size();
+			size_type removed = 0;
 
 			while (it != this->cend())
 			{
+				stats_.on_visit(1);
 				if (static_cast<bool>(std::invoke(p, *it)))
 				{
 					it = this->erase(it);
+					++removed;
 				}
 				else
 				{
@@ -639,200 +1135,1156 @@ namespace constexpr_list
 				}
 			}
 
-			return old_size - this->size();
+			return removed;
+		}
+
+		template <typename UnaryPredicate>
+		[[nodiscard]]
+		constexpr list split_if(UnaryPredicate p)
+		{
+			list result(this->get_allocator());
+
+			this->relink_runs_(p, [&](link_pointer first, link_pointer last, size_type count, link_pointer)
+			{
+				unlink_chain_(first, last);
+				link_chain_(result.end(), first, last);
+				this->shrink_size_(count);
+				result.grow_size_(count);
+				stats_.on_relink(1);
+			});
+
+			return result;
+		}
+
+		template <typename UnaryPredicate>
+		constexpr iterator partition(UnaryPredicate p)
+		{
+			return iterator{ this->relink_runs_(p, [&](link_pointer first, link_pointer last, size_type, link_pointer boundary)
+			{
+				if (boundary != this->sentinel_())
+				{
+					unlink_chain_(first, last);
+					link_chain_(this->begin(), first, last);
+					stats_.on_relink(1);
+				}
+			}) };
+		}
+
+		template <typename UnaryPredicate>
+		constexpr iterator stable_partition(UnaryPredicate p)
+		{
+			return iterator{ this->relink_runs_(p, [&](link_pointer first, link_pointer last, size_type, link_pointer boundary)
+			{
+				if (boundary != this->sentinel_())
+				{
+					unlink_chain_(first, last);
+					link_chain_(const_iterator{ boundary }, first, last);
+					stats_.on_relink(1);
+				}
+			}) };
 		}
 
 		constexpr void reverse() noexcept
 		{
-			links_* node = &ptrs_;
+			link_pointer node = this->sentinel_();
 
 			std::ranges::swap(node->next_, node->prev_);
 			node = node->prev_;
 
-			while (node != &ptrs_)
+			while (node != this->sentinel_())
 			{
 				std::ranges::swap(node->next_, node->prev_);
 				node = node->prev_;
+				stats_.on_visit(1);
 			}
 		}
 	private:
 
-		struct node_;
-		constexpr iterator insert_node_(const_iterator pos, node_* new_node) noexcept
+		template <typename Compare>
+		constexpr const_iterator sorted_position_(const_iterator pos, const T& value, Compare& comp)
+		{
+			const auto less = this->counted_(comp);
+
+			if (pos != this->begin() && less(value, *std::ranges::prev(pos)))
+			{
+				--pos;
+
+				while (pos != this->begin() && less(value, *std::ranges::prev(pos)))
+				{
+					--pos;
+					stats_.on_visit(1);
+				}
+
+				return pos;
+			}
+
+			while (pos != this->end() && !less(value, *pos))
+			{
+				++pos;
+				stats_.on_visit(1);
+			}
+
+			return pos;
+		}
+
+		constexpr iterator insert_node_(const_iterator pos, link_pointer new_node) noexcept
 		{
-			links_* prev = const_cast<links_*>(pos.ptrs_)->prev_;
-			prev->next_ = static_cast<links_*>(new_node);
-			new_node->prev_ = prev;
-			new_node->next_ = const_cast<links_*>(pos.ptrs_);
-			const_cast<links_*>(pos.ptrs_)->prev_ = static_cast<links_*>(new_node);
-			++size_;
-			return iterator{ static_cast<links_*>(new_node) };
+			link_chain_(pos, new_node, new_node);
+			this->grow_size_(1);
+			return iterator{ new_node };
 		}
 
-	public:
-		constexpr void splice(const_iterator pos, list&& other) noexcept
+		static constexpr bool lazy_size_ = std::same_as<size_policy, lazy_size>;
+		static constexpr size_type unknown_size_ = static_cast<size_type>(-1);
+		static constexpr bool heap_sentinel_ = std::same_as<sentinel_policy, heap_sentinel>;
+
+		using anchor_allocator_ = typename std::allocator_traits<Allocator>::template rebind_alloc<links_>;
+		using anchor_traits_ = std::allocator_traits<anchor_allocator_>;
+
+		constexpr bool size_known_() const noexcept
+		{
+			return !lazy_size_ || size_ != unknown_size_;
+		}
+
+		constexpr void grow_size_(size_type count) noexcept
 		{
-			for (iterator it = other.begin(); it != other.end(); ++it)
+			if (this->size_known_())
 			{
-				node_* as_node = static_cast<node_*>(it.ptrs_);
-				this->insert_node_(pos, as_node);
+				size_ += count;
+				stats_.on_size(size_);
 			}
-			other.ptrs_ = { &other.ptrs_, &other.ptrs_ };
-			other.size_ = 0;
 		}
 
-		constexpr void splice(const_iterator pos, list& other) noexcept
+		constexpr void shrink_size_(size_type count) noexcept
 		{
-			this->splice(pos, std::move(other));
+			if (this->size_known_())
+			{
+				size_ -= count;
+			}
 		}
 
-		constexpr void splice(const_iterator pos, list&& other, const_iterator it) noexcept
+		constexpr void forget_size_() noexcept
+		{
+			if constexpr (lazy_size_)
+			{
+				size_ = unknown_size_;
+			}
+		}
+
+		static constexpr void link_chain_(const_iterator pos, link_pointer first, link_pointer last) noexcept
+		{
+			link_pointer next = pos.ptrs_;
+			link_pointer prev = next->prev_;
+			prev->next_ = first;
+			first->prev_ = prev;
+			last->next_ = next;
+			next->prev_ = last;
+		}
+
+		static constexpr void unlink_chain_(link_pointer first, link_pointer last) noexcept
+		{
+			first->prev_->next_ = last->next_;
+			last->next_->prev_ = first->prev_;
+		}
+
+		constexpr void destroy_node_(link_pointer link)
+		{
+			free_node_(alloc_, link);
+			stats_.on_erase();
+		}
+
+		constexpr void destroy_chain_()
+		{
+			link_pointer current = this->anchor_().next_;
+
+			while (current != this->sentinel_())
+			{
+				link_pointer tmp = current->next_;
+				this->destroy_node_(current);
+				current = tmp;
+				stats_.on_visit(1);
+			}
+		}
+
+		constexpr bool release_without_walk_() const noexcept
+		{
+			if constexpr (detail::skips_deallocation<node_allocator> && std::is_trivially_destructible_v<T>)
+			{
+				if !consteval
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		static constexpr void free_node_(node_allocator& alloc, link_pointer link)
+		{
+			node_pointer node = node_pointer_of_(link);
+			std::destroy_at(std::addressof(node->storage_.value_));
+			traits::destroy(alloc, std::to_address(node));
+			traits::deallocate(alloc, node, 1);
+		}
+
+		static constexpr const T& value_of_(links_* node) noexcept
+		{
+			return static_cast<node_*>(node)->storage_.value_;
+		}
+
+		template <typename Compare>
+		constexpr auto counted_(Compare& comp) noexcept
+		{
+			return [this, &comp](const T& lhs, const T& rhs) -> bool
+			{
+				stats_.on_compare();
+				return std::invoke(comp, lhs, rhs);
+			};
+		}
+
+		template <typename Reorder>
+		constexpr void reorder_(Reorder reorder)
+		{
+			if (this->empty())
+			{
+				return;
+			}
+
+			using temp_alloc_t = typename traits::template rebind_alloc<links_*>;
+			temp_alloc_t temp_alloc{ alloc_ };
+
+			const size_type count = this->size();
+			auto storage = std::allocator_traits<temp_alloc_t>::allocate(temp_alloc, count);
+			links_** ptr = std::to_address(storage);
+
+			for (iterator it = begin(); it != end(); ++it)
+			{
+				*ptr = std::to_address(it.ptrs_);
+				++ptr;
+			}
+
+			stats_.on_visit(count);
+
+			auto as_range = std::ranges::subrange(std::to_address(storage), std::to_address(storage) + count);
+
+			try
+			{
+				reorder(as_range);
+			}
+			catch (...)
+			{
+				std::allocator_traits<temp_alloc_t>::deallocate(temp_alloc, storage, count);
+				throw;
+			}
+
+			for (auto pair : as_range | std::views::slide(2))
+			{
+				links_* lhs = pair[0];
+				links_* rhs = pair[1];
+				lhs->next_ = link_of_(rhs);
+				rhs->prev_ = link_of_(lhs);
+			}
+
+			this->anchor_().next_ = link_of_(as_range.front());
+			this->anchor_().prev_ = link_of_(as_range.back());
+
+			as_range.front()->prev_ = this->sentinel_();
+			as_range.back()->next_ = this->sentinel_();
+
+			stats_.on_relink(count);
+
+			std::allocator_traits<temp_alloc_t>::deallocate(temp_alloc, storage, count);
+		}
+
+		template <typename UnaryPredicate, typename Relink>
+		constexpr link_pointer relink_runs_(UnaryPredicate& p, Relink relink)
+		{
+			const auto matches = [&](link_pointer node)
+			{
+				stats_.on_visit(1);
+				return static_cast<bool>(std::invoke(p, std::as_const(node_of_(node).storage_.value_)));
+			};
+
+			link_pointer boundary = this->sentinel_();
+			link_pointer node = this->anchor_().next_;
+
+			while (node != this->sentinel_())
+			{
+				if (!matches(node))
+				{
+					if (boundary == this->sentinel_())
+					{
+						boundary = node;
+					}
+
+					node = node->next_;
+					continue;
+				}
+
+				link_pointer first = node;
+				link_pointer last = node;
+				size_type count = 1;
+
+				for (node = node->next_; node != this->sentinel_() && matches(node); node = node->next_)
+				{
+					last = node;
+					++count;
+				}
+
+				relink(first, last, count, boundary);
+			}
+
+			return boundary;
+		}
+
+		template <typename U>
+		static constexpr bool block_searchable_ = detail::block_comparable<T> && std::same_as<T, U>;
+
+		using block_ = std::array<T, detail::gather_width>;
+
+		static constexpr std::uint32_t lanes_(std::size_t count) noexcept
+		{
+			return (std::uint32_t{ 1 } << count) - 1;
+		}
+
+		std::size_t gather_(link_pointer& node, T* values, link_pointer* links) const noexcept
+		{
+			const link_pointer end = this->sentinel_();
+			std::size_t count = 0;
+
+			while (count < detail::gather_width && node != end)
+			{
+				values[count] = node_of_(node).storage_.value_;
+
+				if (links)
+				{
+					links[count] = node;
+				}
+
+				node = node->next_;
+				++count;
+			}
+
+			return count;
+		}
+
+		size_type count_blocks_(const T& value) const noexcept
+		{
+			block_ needle;
+			needle.fill(value);
+			block_ values{};
+			size_type matches = 0;
+
+			for (link_pointer node = this->anchor_().next_; node != this->sentinel_();)
+			{
+				const std::size_t count = this->gather_(node, values.data(), nullptr);
+				matches += std::popcount(detail::equal_mask(values.data(), needle.data()) & lanes_(count));
+			}
+
+			return matches;
+		}
+
+		link_pointer find_blocks_(const T& value) const noexcept
+		{
+			block_ needle;
+			needle.fill(value);
+			block_ values{};
+			std::array<link_pointer, detail::gather_width> links{};
+
+			for (link_pointer node = this->anchor_().next_; node != this->sentinel_();)
+			{
+				const std::size_t count = this->gather_(node, values.data(), links.data());
+
+				if (const std::uint32_t mask = detail::equal_mask(values.data(), needle.data()) & lanes_(count))
+				{
+					return links[std::countr_zero(mask)];
+				}
+			}
+
+			return this->sentinel_();
+		}
+
+		size_type remove_blocks_(const T& value)
+		{
+			block_ needle;
+			needle.fill(value);
+			block_ values{};
+			std::array<link_pointer, detail::gather_width> links{};
+			size_type removed = 0;
+
+			for (link_pointer node = this->anchor_().next_; node != this->sentinel_();)
+			{
+				const std::size_t count = this->gather_(node, values.data(), links.data());
+				stats_.on_visit(count);
+
+				for (std::uint32_t mask = detail::equal_mask(values.data(), needle.data()) & lanes_(count); mask; mask &= mask - 1)
+				{
+					this->erase(const_iterator{ links[std::countr_zero(mask)] });
+					++removed;
+				}
+			}
+
+			return removed;
+		}
+
+		static bool equal_blocks_(const list& lhs, const list& rhs) noexcept
+		{
+			if (lhs.size() != rhs.size())
+			{
+				return false;
+			}
+
+			block_ left{};
+			block_ right{};
+			link_pointer l = lhs.anchor_().next_;
+			link_pointer r = rhs.anchor_().next_;
+
+			while (l != lhs.sentinel_())
+			{
+				const std::uint32_t lanes = lanes_(lhs.gather_(l, left.data(), nullptr));
+				rhs.gather_(r, right.data(), nullptr);
+
+				if ((detail::equal_mask(left.data(), right.data()) & lanes) != lanes)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		static constexpr std::uint64_t serialization_magic_ = 0x3130'5453'494C'5843ull;
+
+		constexpr std::byte* write_header_(std::byte* out) const noexcept
+		{
+			detail::store_bytes(out, serialization_magic_);
+			detail::store_bytes(out + sizeof(std::uint64_t), static_cast<std::uint64_t>(sizeof(T)));
+			detail::store_bytes(out + 2 * sizeof(std::uint64_t), static_cast<std::uint64_t>(this->size()));
+			return out + serialized_header_size;
+		}
+
+		static constexpr size_type read_header_(const std::byte* in)
+		{
+			if (detail::load_bytes<std::uint64_t>(in) != serialization_magic_)
+			{
+				throw std::invalid_argument("list::load: not a serialized list");
+			}
+
+			if (detail::load_bytes<std::uint64_t>(in + sizeof(std::uint64_t)) != sizeof(T))
+			{
+				throw std::invalid_argument("list::load: element size mismatch");
+			}
+
+			return static_cast<size_type>(detail::load_bytes<std::uint64_t>(in + 2 * sizeof(std::uint64_t)));
+		}
+
+		constexpr void append_bytes_(const std::byte* in, size_type count)
+		{
+			for (size_type i = 0; i < count; ++i, in += sizeof(T))
+			{
+				node_pointer new_node = traits::allocate(alloc_, 1);
+				traits::construct(alloc_, std::to_address(new_node), std::in_place, detail::load_bytes<T>(in));
+				link_chain_(iterator{ this->sentinel_() }, link_of_(new_node), link_of_(new_node));
+			}
+
+			this->grow_size_(count);
+		}
+
+		constexpr link_pointer sentinel_() const noexcept
+		{
+			if constexpr (heap_sentinel_)
+			{
+				return ptrs_;
+			}
+			else
+			{
+				return link_of_(const_cast<links_&>(ptrs_));
+			}
+		}
+
+		constexpr links_& anchor_() noexcept
 		{
-			links_* as_node = const_cast<links_*>(it.ptrs_);
-			links_* prev = as_node->prev_;
-			prev->next_ = as_node->next_;
-			as_node->next_->prev_ = prev;
-			--other.size_;
+			return *this->sentinel_();
+		}
 
-			this->insert_node_(pos, static_cast<node_*>(as_node));
+		constexpr const links_& anchor_() const noexcept
+		{
+			return *this->sentinel_();
+		}
+
+		constexpr auto make_anchor_()
+		{
+			if constexpr (heap_sentinel_)
+			{
+				anchor_allocator_ alloc(alloc_);
+				link_pointer anchor = anchor_traits_::allocate(alloc, 1);
+				std::construct_at(std::to_address(anchor), links_{ anchor, anchor });
+				return anchor;
+			}
+			else
+			{
+				return links_{ link_of_(ptrs_), link_of_(ptrs_) };
+			}
+		}
+
+		constexpr void free_anchor_() noexcept
+		{
+			anchor_allocator_ alloc(alloc_);
+			std::destroy_at(std::to_address(ptrs_));
+			anchor_traits_::deallocate(alloc, ptrs_, 1);
+		}
+
+		constexpr void replace_allocator_(const node_allocator& alloc)
+		{
+			if constexpr (heap_sentinel_)
+			{
+				anchor_allocator_ anchor_alloc(alloc);
+				link_pointer anchor = anchor_traits_::allocate(anchor_alloc, 1);
+				std::construct_at(std::to_address(anchor), links_{ anchor, anchor });
+				this->free_anchor_();
+				ptrs_ = anchor;
+			}
+
+			alloc_ = alloc;
+		}
+
+		constexpr void steal_chain_(list& other) noexcept
+		{
+			if constexpr (heap_sentinel_)
+			{
+				std::ranges::swap(ptrs_, other.ptrs_);
+			}
+			else if (!other.empty())
+			{
+				ptrs_ = other.ptrs_;
+				ptrs_.next_->prev_ = this->sentinel_();
+				ptrs_.prev_->next_ = this->sentinel_();
+				other.ptrs_ = links_{ other.sentinel_(), other.sentinel_() };
+			}
+
+			size_ = std::exchange(other.size_, 0);
+		}
+
+		static constexpr link_pointer link_of_(links_& link) noexcept
+		{
+			return detail::pointer_to<link_pointer>(link);
+		}
+
+		static constexpr link_pointer link_of_(links_* link) noexcept
+		{
+			if constexpr (std::is_convertible_v<links_*, link_pointer>)
+			{
+				return link;
+			}
+			else
+			{
+				return detail::pointer_to<link_pointer>(*link);
+			}
+		}
+
+		static constexpr link_pointer link_of_(node_pointer node) noexcept
+		{
+			if constexpr (std::is_convertible_v<node_pointer, link_pointer>)
+			{
+				return node;
+			}
+			else
+			{
+				return detail::pointer_to<link_pointer>(*node);
+			}
+		}
+
+		static constexpr node_pointer node_pointer_of_(link_pointer link) noexcept
+		{
+			if constexpr (std::is_pointer_v<link_pointer>)
+			{
+				return static_cast<node_*>(link);
+			}
+			else
+			{
+				return detail::pointer_to<node_pointer>(node_of_(link));
+			}
+		}
+
+		static constexpr node_& node_of_(link_pointer link) noexcept
+		{
+			return static_cast<node_&>(*link);
+		}
+
+	public:
+		constexpr void splice(const_iterator pos, list&& other) noexcept
+		{
+			if (other.empty())
+			{
+				return;
+			}
+
+			link_pointer first = other.anchor_().next_;
+			link_pointer last = other.anchor_().prev_;
+			link_chain_(pos, first, last);
+			stats_.on_relink(1);
+
+			if (other.size_known_())
+			{
+				this->grow_size_(other.size_);
+			}
+			else
+			{
+				this->forget_size_();
+			}
+
+			other.anchor_() = links_{ other.sentinel_(), other.sentinel_() };
+			other.size_ = 0;
+		}
+
+		constexpr void splice(const_iterator pos, list& other) noexcept
+		{
+			this->splice(pos, std::move(other));
+		}
+
+		constexpr void splice(const_iterator pos, list&& other, const_iterator it) noexcept
+		{
+			link_pointer as_node = it.ptrs_;
+
+			if (pos.ptrs_ == as_node || pos.ptrs_ == as_node->next_)
+			{
+				return;
+			}
+
+			unlink_chain_(as_node, as_node);
+			other.shrink_size_(1);
+
+			this->insert_node_(pos, as_node);
+			stats_.on_relink(1);
+		}
+
+		constexpr void splice(const_iterator pos, list& other, const_iterator it) noexcept
+		{
+			this->splice(pos, std::move(other), it);
+		}
+
+		constexpr void splice(const_iterator pos, list&& other,
+			const_iterator first, const_iterator last) noexcept
+		{
+			if (first == last)
+			{
+				return;
+			}
+
+			link_pointer first_node = first.ptrs_;
+			link_pointer last_node = last.ptrs_->prev_;
+
+			if (this != &other)
+			{
+				if constexpr (lazy_size_)
+				{
+					this->forget_size_();
+					other.forget_size_();
+				}
+				else
+				{
+					const auto count = static_cast<size_type>(std::ranges::distance(first, last));
+					stats_.on_visit(count);
+					other.shrink_size_(count);
+					this->grow_size_(count);
+				}
+			}
+
+			unlink_chain_(first_node, last_node);
+			link_chain_(pos, first_node, last_node);
+			stats_.on_relink(1);
+		}
+
+		constexpr void splice(const_iterator pos, list& other,
+			const_iterator first, const_iterator last) noexcept
+		{
+			this->splice(pos, std::move(other), first, last);
+		}
+
+		template <typename Compare>
+		constexpr void merge(list&& other, Compare comp) noexcept
+		{
+			if (this == &other)
+			{
+				return;
+			}
+
+			auto pos = this->begin();
+			auto it = other.begin();
+
+			if (it == other.end())
+			{
+				return;
+			}
+
+			if (pos == this->end())
+			{
+				this->splice(pos, other);
+				return;
+			}
+
+			for (;;)
+			{
+				const T& value = *it;
+				stats_.on_visit(1);
+				stats_.on_compare();
+				if (std::invoke(comp, value, *pos))
+				{
+					auto tmp = std::ranges::next(it);
+					this->splice(pos, other, it);
+					it = tmp;
+
+					if (it == other.end())
+					{
+						return;
+					}
+				}
+				else
+				{
+					++pos;
+
+					if (pos == this->end())
+					{
+						this->splice(pos, other, it, other.end());
+						return;
+					}
+				}
+			}
+		}
+
+		template <typename Compare>
+		constexpr void merge(list& other, Compare comp) noexcept
+		{
+			this->merge(std::move(other), std::ref(comp));
+		}
+
+		constexpr void merge(list& other) noexcept
+		{
+			this->merge(std::move(other), std::less{});
+		}
+
+		constexpr void merge(list&& other) noexcept
+		{
+			this->merge(std::move(other), std::less{});
+		}
+
+		template <typename Compare>
+		constexpr iterator insert_sorted(const_iterator finger, const T& value, Compare comp)
+		{
+			return this->emplace(this->sorted_position_(finger, value, comp), value);
+		}
+
+		template <typename Compare>
+		constexpr iterator insert_sorted(const_iterator finger, T&& value, Compare comp)
+		{
+			return this->emplace(this->sorted_position_(finger, value, comp), std::move(value));
+		}
+
+		constexpr iterator insert_sorted(const_iterator finger, const T& value)
+		{
+			return this->insert_sorted(finger, value, std::less{});
+		}
+
+		constexpr iterator insert_sorted(const_iterator finger, T&& value)
+		{
+			return this->insert_sorted(finger, std::move(value), std::less{});
+		}
+
+		template <typename Compare>
+		constexpr iterator insert_sorted(const T& value, Compare comp)
+		{
+			return this->insert_sorted(this->end(), value, std::ref(comp));
+		}
+
+		template <typename Compare>
+		constexpr iterator insert_sorted(T&& value, Compare comp)
+		{
+			return this->insert_sorted(this->end(), std::move(value), std::ref(comp));
+		}
+
+		constexpr iterator insert_sorted(const T& value)
+		{
+			return this->insert_sorted(this->end(), value, std::less{});
+		}
+
+		constexpr iterator insert_sorted(T&& value)
+		{
+			return this->insert_sorted(this->end(), std::move(value), std::less{});
+		}
+
+		template <typename Compare, typename ... Args>
+			requires std::strict_weak_order<Compare&, const T&, const T&> && std::constructible_from<T, Args...>
+		constexpr iterator emplace_sorted_hint(const_iterator finger, Compare comp, Args&& ... args)
+		{
+			node_pointer new_node = traits::allocate(alloc_, 1);
+
+			try
+			{
+				traits::construct(alloc_, std::to_address(new_node), std::in_place, std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				traits::deallocate(alloc_, new_node, 1);
+				throw;
+			}
+
+			try
+			{
+				return this->insert_node_(this->sorted_position_(finger, new_node->storage_.value_, comp), link_of_(new_node));
+			}
+			catch (...)
+			{
+				free_node_(alloc_, link_of_(new_node));
+				throw;
+			}
+		}
+
+		template <typename ... Args> requires std::constructible_from<T, Args...>
+		constexpr iterator emplace_sorted_hint(const_iterator finger, Args&& ... args)
+		{
+			return this->emplace_sorted_hint(finger, std::less{}, std::forward<Args>(args)...);
+		}
+
+		template <typename Compare, typename ... Args>
+			requires std::strict_weak_order<Compare&, const T&, const T&> && std::constructible_from<T, Args...>
+		constexpr iterator emplace_sorted(Compare comp, Args&& ... args)
+		{
+			return this->emplace_sorted_hint(this->end(), std::ref(comp), std::forward<Args>(args)...);
+		}
+
+		template <typename ... Args> requires std::constructible_from<T, Args...>
+		constexpr iterator emplace_sorted(Args&& ... args)
+		{
+			return this->emplace_sorted_hint(this->end(), std::less{}, std::forward<Args>(args)...);
+		}
+
+		template <detail::container_compatible_range<T> R, typename Compare>
+		constexpr void insert_sorted_range(R&& rg, Compare comp)
+		{
+			list batch(std::from_range, std::forward<R>(rg), alloc_);
+			batch.sort(std::ref(comp));
+			this->merge(batch, std::ref(comp));
+		}
+
+		template <detail::container_compatible_range<T> R>
+		constexpr void insert_sorted_range(R&& rg)
+		{
+			this->insert_sorted_range(std::forward<R>(rg), std::less{});
+		}
+
+		template <typename Compare>
+		constexpr void set_union(list&& other, Compare comp)
+		{
+			if (this == &other)
+			{
+				return;
+			}
+
+			auto pos = this->begin();
+			auto it = other.begin();
+
+			while (it != other.end())
+			{
+				if (pos == this->end())
+				{
+					this->splice(pos, other, it, other.end());
+					return;
+				}
+
+				stats_.on_visit(1);
+
+				if (stats_.on_compare(), std::invoke(comp, *it, *pos))
+				{
+					this->splice(pos, other, it++);
+				}
+				else if (stats_.on_compare(), std::invoke(comp, *pos, *it))
+				{
+					++pos;
+				}
+				else
+				{
+					++pos;
+					++it;
+				}
+			}
+		}
+
+		template <typename Compare>
+		constexpr void set_union(list& other, Compare comp)
+		{
+			this->set_union(std::move(other), std::ref(comp));
+		}
+
+		constexpr void set_union(list& other)
+		{
+			this->set_union(std::move(other), std::less{});
+		}
+
+		constexpr void set_union(list&& other)
+		{
+			this->set_union(std::move(other), std::less{});
+		}
+
+		template <typename Compare>
+		constexpr size_type set_intersection(const list& other, Compare comp)
+		{
+			if (this == &other)
+			{
+				return 0;
+			}
+
+			const size_type old_size = this->size();
+			auto pos = this->begin();
+			auto it = other.begin();
+
+			while (pos != this->end())
+			{
+				if (it == other.end())
+				{
+					this->erase(pos, this->end());
+					break;
+				}
+
+				stats_.on_visit(1);
+
+				if (stats_.on_compare(), std::invoke(comp, *pos, *it))
+				{
+					pos = this->erase(pos);
+				}
+				else if (stats_.on_compare(), std::invoke(comp, *it, *pos))
+				{
+					++it;
+				}
+				else
+				{
+					++pos;
+					++it;
+				}
+			}
+
+			return old_size - this->size();
+		}
+
+		constexpr size_type set_intersection(const list& other)
+		{
+			return this->set_intersection(other, std::less{});
+		}
+
+		template <typename Compare>
+		constexpr size_type set_difference(const list& other, Compare comp)
+		{
+			if (this == &other)
+			{
+				const size_type old_size = this->size();
+				this->clear();
+				return old_size;
+			}
+
+			size_type counter = 0;
+			auto pos = this->begin();
+			auto it = other.begin();
+
+			while (pos != this->end() && it != other.end())
+			{
+				stats_.on_visit(1);
+
+				if (stats_.on_compare(), std::invoke(comp, *pos, *it))
+				{
+					++pos;
+				}
+				else if (stats_.on_compare(), std::invoke(comp, *it, *pos))
+				{
+					++it;
+				}
+				else
+				{
+					pos = this->erase(pos);
+					++it;
+					++counter;
+				}
+			}
+
+			return counter;
+		}
+
+		constexpr size_type set_difference(const list& other)
+		{
+			return this->set_difference(other, std::less{});
+		}
+
+		template <typename Compare>
+		constexpr void set_symmetric_difference(list&& other, Compare comp)
+		{
+			if (this == &other)
+			{
+				this->clear();
+				return;
+			}
+
+			auto pos = this->begin();
+			auto it = other.begin();
+
+			while (it != other.end())
+			{
+				if (pos == this->end())
+				{
+					this->splice(pos, other, it, other.end());
+					return;
+				}
+
+				stats_.on_visit(1);
+
+				if (stats_.on_compare(), std::invoke(comp, *it, *pos))
+				{
+					this->splice(pos, other, it++);
+				}
+				else if (stats_.on_compare(), std::invoke(comp, *pos, *it))
+				{
+					++pos;
+				}
+				else
+				{
+					pos = this->erase(pos);
+					++it;
+				}
+			}
+		}
+
+		template <typename Compare>
+		constexpr void set_symmetric_difference(list& other, Compare comp)
+		{
+			this->set_symmetric_difference(std::move(other), std::ref(comp));
+		}
+
+		constexpr void set_symmetric_difference(list& other)
+		{
+			this->set_symmetric_difference(std::move(other), std::less{});
+		}
+
+		constexpr void set_symmetric_difference(list&& other)
+		{
+			this->set_symmetric_difference(std::move(other), std::less{});
+		}
+
+		template <typename Compare>
+		constexpr void sort(Compare comp)
+		{
+			this->reorder_([&](auto nodes)
+			{
+				std::ranges::sort(nodes, this->counted_(comp), value_of_);
+			});
 		}
 
-		constexpr void splice(const_iterator pos, list& other, const_iterator it) noexcept
+		constexpr void sort()
 		{
-			this->splice(pos, std::move(other), it);
+			this->sort(std::less{});
 		}
 
-		constexpr void splice(const_iterator pos, list&& other,
-			const_iterator first, const_iterator last) noexcept
+		template <typename Compare>
+		constexpr void partial_sort(size_type k, Compare comp)
 		{
-			for (const_iterator it = first; it != last;)
+			this->reorder_([&](auto nodes)
 			{
-				auto tmp = std::ranges::next(it);
-				this->splice(pos, other, it);
-				it = tmp;
-			}
+				std::ranges::partial_sort(nodes, nodes.begin() + static_cast<difference_type>(std::min(k, nodes.size())),
+					this->counted_(comp), value_of_);
+			});
 		}
 
-		constexpr void splice(const_iterator pos, list& other,
-			const_iterator first, const_iterator last) noexcept
+		constexpr void partial_sort(size_type k)
 		{
-			this->splice(pos, std::move(other), first, last);
+			this->partial_sort(k, std::less{});
 		}
 
 		template <typename Compare>
-		constexpr void merge(list&& other, Compare comp) noexcept
+		constexpr iterator nth_element(size_type n, Compare comp)
 		{
-			if (this == &other)
-			{
-				return;
-			}
+			link_pointer nth = this->sentinel_();
 
-			auto pos = this->begin();
-			auto it = other.begin();
-
-			if (it == other.end())
-			{
-				return;
-			}
-
-			if (pos == this->end())
-			{
-				this->splice(pos, other, it);
-				return;
-			}
-
-			for (;;)
+			this->reorder_([&](auto nodes)
 			{
-				const T& value = *it;
-				if (std::invoke(comp, value, *pos))
+				if (n < nodes.size())
 				{
-					auto tmp = std::ranges::next(it);
-					this->splice(pos, other, it);
-					it = tmp;
-
-					if (it == other.end())
-					{
-						return;
-					}
+					std::ranges::nth_element(nodes, nodes.begin() + static_cast<difference_type>(n), this->counted_(comp), value_of_);
+					nth = link_of_(nodes[n]);
 				}
-				else
-				{
-					++pos;
+			});
 
-					if (pos == this->end())
-					{
-						this->splice(pos, other, it, other.end());
-						return;
-					}
-				}
-			}
+			return iterator{ nth };
 		}
 
-		template <std::indirect_binary_predicate Compare>
-		constexpr void merge(list& other, Compare comp) noexcept
+		constexpr iterator nth_element(size_type n)
 		{
-			this->merge(std::move(other), std::ref(comp));
+			return this->nth_element(n, std::less{});
 		}
 
-		constexpr void merge(list& other) noexcept
+		template <typename URBG>
+			requires std::uniform_random_bit_generator<std::remove_reference_t<URBG>>
+		constexpr void shuffle(URBG&& g)
 		{
-			this->merge(std::move(other), std::less{});
+			this->reorder_([&](auto nodes)
+			{
+				for (size_type i = nodes.size(); i > 1; --i)
+				{
+					std::ranges::swap(nodes[i - 1], nodes[detail::uniform_index(g, i)]);
+				}
+			});
 		}
 
-		constexpr void merge(list&& other) noexcept
+		constexpr iterator rotate(const_iterator mid) noexcept
 		{
-			this->merge(std::move(other), std::less{});
-		}
+			link_pointer first = this->anchor_().next_;
+			link_pointer middle = mid.ptrs_;
 
-		template <typename Compare>
-		constexpr void sort(Compare comp)
-		{
-			if (this->empty())
+			if (middle == first)
 			{
-				return;
+				return this->end();
 			}
 
-			using temp_alloc_t = typename traits::template rebind_alloc<links_*>;
-			temp_alloc_t temp_alloc{ alloc_ };
-			
-			auto storage = std::allocator_traits<temp_alloc_t>::allocate(temp_alloc, this->size());
-			links_** ptr = &storage[0];
-
-			for (iterator it = begin(); it != end(); ++it)
+			if (middle == this->sentinel_())
 			{
-				*ptr = it.ptrs_;
-				++ptr;
+				return iterator{ first };
 			}
 
-			auto as_range = std::ranges::subrange(&storage[0], &storage[size()]);
+			link_pointer before_mid = middle->prev_;
+			link_pointer last = this->anchor_().prev_;
 
-			std::ranges::sort(as_range, std::ref(comp),
-				[](links_* node) -> const T&
-				{
-					node_* as_node = static_cast<node_*>(node);
-					return as_node->storage_.value_;
-				});
+			last->next_ = first;
+			first->prev_ = last;
+			before_mid->next_ = this->sentinel_();
+			middle->prev_ = this->sentinel_();
+			this->anchor_().next_ = middle;
+			this->anchor_().prev_ = before_mid;
+			stats_.on_relink(1);
 
-			for (auto pair : as_range | std::views::slide(2))
+			return iterator{ first };
+		}
+
+		constexpr void reverse(const_iterator first, const_iterator last) noexcept
+		{
+			link_pointer head = first.ptrs_;
+			link_pointer next = last.ptrs_;
+
+			if (head == next || head->next_ == next)
 			{
-				links_* lhs = pair[0];
-				links_* rhs = pair[1];
-				lhs->next_ = rhs;
-				rhs->prev_ = lhs;
+				return;
 			}
 
-			ptrs_.next_ = as_range.front();
-			ptrs_.prev_ = as_range.back();
-
-			as_range.front()->prev_ = &ptrs_;
-			as_range.back()->next_ = &ptrs_;
+			link_pointer prev = head->prev_;
+			link_pointer tail = next->prev_;
 
-			std::allocator_traits<temp_alloc_t>::deallocate(temp_alloc, storage, this->size());
-		}
+			for (link_pointer node = head; node != next;)
+			{
+				link_pointer following = node->next_;
+				std::ranges::swap(node->next_, node->prev_);
+				node = following;
+				stats_.on_visit(1);
+			}
 
-		constexpr void sort()
-		{
-			this->sort(std::less{});
+			prev->next_ = tail;
+			tail->prev_ = prev;
+			head->next_ = next;
+			next->prev_ = head;
+			stats_.on_relink(1);
 		}
 
 		constexpr void resize(size_type count) requires (std::is_default_constructible_v<T>)
@@ -877,9 +2329,37 @@ namespace constexpr_list
 			return static_cast<allocator_type>(alloc_);
 		}
 
+		[[nodiscard]]
+		constexpr const stats_type& stats() const noexcept
+		{
+			return stats_;
+		}
+
+		constexpr void reset_stats() noexcept
+		{
+			stats_ = stats_type{};
+		}
+
 		[[nodiscard]]
 		constexpr size_type size() const noexcept
 		{
+			if (!this->size_known_())
+			{
+				return static_cast<size_type>(std::ranges::distance(this->begin(), this->end()));
+			}
+
+			return size_;
+		}
+
+		[[nodiscard]]
+		constexpr size_type size() noexcept
+			requires std::same_as<size_policy, lazy_size>
+		{
+			if (!this->size_known_())
+			{
+				size_ = static_cast<size_type>(std::ranges::distance(this->begin(), this->end()));
+			}
+
 			return size_;
 		}
 
@@ -892,27 +2372,100 @@ namespace constexpr_list
 		[[nodiscard]]
 		constexpr bool empty() const noexcept
 		{
-			return size() == 0;
+			return this->anchor_().next_ == this->sentinel_();
+		}
+
+		[[nodiscard]]
+		constexpr node_layout layout_stats() const noexcept
+		{
+			node_layout layout;
+			layout.node_bytes = sizeof(node_);
+
+			if consteval
+			{
+				layout.nodes = static_cast<std::size_t>(std::ranges::distance(this->begin(), this->end()));
+			}
+			else
+			{
+				std::array<std::uintptr_t, std::bit_ceil(node_layout::window * 2)> pages{};
+				const std::size_t mask = pages.size() - 1;
+				std::size_t distinct_pages = 0;
+				std::size_t same_line = 0;
+				std::size_t same_page = 0;
+				std::uintptr_t previous = 0;
+
+				for (link_pointer node = this->anchor_().next_; node != this->sentinel_(); node = node->next_)
+				{
+					const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(std::to_address(node));
+					const std::uintptr_t page = address / node_layout::page + 1;
+
+					if (layout.nodes % node_layout::window == 0)
+					{
+						pages.fill(0);
+					}
+
+					std::size_t slot = page & mask;
+
+					while (pages[slot] != 0 && pages[slot] != page)
+					{
+						slot = (slot + 1) & mask;
+					}
+
+					if (pages[slot] == 0)
+					{
+						pages[slot] = page;
+						++distinct_pages;
+					}
+
+					if (layout.nodes != 0)
+					{
+						const std::uintptr_t stride = address > previous ? address - previous : previous - address;
+
+						++layout.stride_histogram[std::min<std::size_t>(std::bit_width(stride), node_layout::stride_buckets - 1)];
+						layout.backward_strides += address < previous;
+						same_line += address / node_layout::cache_line == previous / node_layout::cache_line;
+						same_page += address / node_layout::page == previous / node_layout::page;
+					}
+
+					previous = address;
+					++layout.nodes;
+				}
+
+				if (layout.nodes > 1)
+				{
+					layout.same_cache_line = static_cast<double>(same_line) / static_cast<double>(layout.nodes - 1);
+					layout.same_page = static_cast<double>(same_page) / static_cast<double>(layout.nodes - 1);
+				}
+
+				if (layout.nodes != 0)
+				{
+					const std::size_t windows = (layout.nodes + node_layout::window - 1) / node_layout::window;
+					layout.pages_per_window = static_cast<double>(distinct_pages) / static_cast<double>(windows);
+				}
+			}
+
+			layout.overhead_bytes = layout.nodes * (sizeof(node_) - sizeof(T));
+			return layout;
 		}
 
 		constexpr iterator begin() noexcept
 		{
-			return iterator{ ptrs_.next_ };
+			return iterator{ this->anchor_().next_ };
 		}
 
 		constexpr iterator end() noexcept
 		{
-			return iterator{ &ptrs_ };
+			return iterator{ this->sentinel_() };
 		}
 
 		constexpr const_iterator begin() const noexcept
 		{
-			return const_iterator{ ptrs_.next_ };
+			return const_iterator{ this->anchor_().next_ };
 		}
 
 		constexpr const_iterator end() const noexcept
 		{
-			return const_iterator{ &ptrs_ };
+			return const_iterator{ this->sentinel_() };
 		}
 
 		constexpr const_iterator cbegin() const noexcept
@@ -922,27 +2475,27 @@ namespace constexpr_list
 
 		constexpr const_iterator cend() const noexcept
 		{
-			return this->cend();
+			return this->end();
 		}
 
 		constexpr reverse_iterator rbegin() noexcept
 		{
-			return std::make_reverse_iterator(this->begin());
+			return std::make_reverse_iterator(this->end());
 		}
 
 		constexpr reverse_iterator rend() noexcept
 		{
-			return std::make_reverse_iterator(this->end());
+			return std::make_reverse_iterator(this->begin());
 		}
 
 		constexpr const_reverse_iterator rbegin() const noexcept
 		{
-			return std::make_reverse_iterator(this->cbegin());
+			return std::make_reverse_iterator(this->cend());
 		}
 
 		constexpr const_reverse_iterator rend() const noexcept
 		{
-			return std::make_reverse_iterator(this->cend());
+			return std::make_reverse_iterator(this->cbegin());
 		}
 
 		constexpr const_reverse_iterator crbegin() const noexcept
@@ -975,22 +2528,32 @@ namespace constexpr_list
 			return *std::ranges::prev(cend());
 		}
 
-		constexpr void clear()
+		[[nodiscard]]
+		constexpr reclaimer detach_for_reclaim() noexcept
 		{
-			links_* current = ptrs_.next_;
-			while (size_)
+			if (this->empty())
 			{
-				links_* tmp = current->next_;
+				return reclaimer(nullptr, alloc_);
+			}
 
-				std::destroy_at(std::addressof(static_cast<node_*>(current)->storage_.value_));
-				traits::destroy(alloc_, static_cast<node_*>(current));
-				traits::deallocate(alloc_, static_cast<node_*>(current), 1);
+			link_pointer first = this->anchor_().next_;
+			this->anchor_().prev_->next_ = nullptr;
+			this->anchor_().next_ = this->sentinel_();
+			this->anchor_().prev_ = this->sentinel_();
+			size_ = 0;
+			return reclaimer(first, alloc_);
+		}
 
-				current = tmp;
-				--size_;
+		constexpr void clear()
+		{
+			if (!this->release_without_walk_())
+			{
+				this->destroy_chain_();
 			}
-			ptrs_.next_ = &ptrs_;
-			ptrs_.prev_ = &ptrs_;
+
+			size_ = 0;
+			this->anchor_().next_ = this->sentinel_();
+			this->anchor_().prev_ = this->sentinel_();
 		}
 
 		constexpr size_type unique()
@@ -1014,7 +2577,8 @@ namespace constexpr_list
 				size_type to_be_erased = 0;
 				
 				auto it2 = std::ranges::next(it);
-				while (it2 != end() && p(value, *it2))
+				stats_.on_visit(1);
+				while (it2 != end() && (stats_.on_compare(), p(value, *it2)))
 				{
 					++it2;
 					to_be_erased++;
@@ -1027,6 +2591,75 @@ namespace constexpr_list
 			return counter;
 		}
 
+		template <typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<>>
+		constexpr size_type unique_unordered(Hash hash = Hash(), KeyEqual eq = KeyEqual())
+		{
+			if (this->empty())
+			{
+				return 0;
+			}
+
+			using table_alloc_t = typename traits::template rebind_alloc<links_*>;
+			table_alloc_t table_alloc{ alloc_ };
+
+			const size_type capacity = std::bit_ceil(this->size() * 2);
+			auto storage = std::allocator_traits<table_alloc_t>::allocate(table_alloc, capacity);
+			links_** table = std::to_address(storage);
+			std::ranges::fill_n(table, static_cast<difference_type>(capacity), nullptr);
+
+			link_pointer removed = nullptr;
+			size_type counter = 0;
+
+			const auto release = [&]
+			{
+				while (removed)
+				{
+					this->destroy_node_(std::exchange(removed, removed->next_));
+				}
+
+				std::allocator_traits<table_alloc_t>::deallocate(table_alloc, storage, capacity);
+			};
+
+			try
+			{
+				for (link_pointer node = this->anchor_().next_; node != this->sentinel_();)
+				{
+					link_pointer next = node->next_;
+					const T& value = value_of_(std::to_address(node));
+					size_type slot = static_cast<size_type>(std::invoke(hash, value)) & (capacity - 1);
+					stats_.on_visit(1);
+
+					while (table[slot] && (stats_.on_compare(), !std::invoke(eq, value_of_(table[slot]), value)))
+					{
+						slot = (slot + 1) & (capacity - 1);
+					}
+
+					if (table[slot])
+					{
+						unlink_chain_(node, node);
+						node->next_ = removed;
+						removed = node;
+						this->shrink_size_(1);
+						++counter;
+					}
+					else
+					{
+						table[slot] = std::to_address(node);
+					}
+
+					node = next;
+				}
+			}
+			catch (...)
+			{
+				release();
+				throw;
+			}
+
+			release();
+			return counter;
+		}
+
 		constexpr void swap(list& other) noexcept
 		{
 			if constexpr (std::allocator_traits<node_allocator>::propagate_on_container_swap::value)
@@ -1034,24 +2667,28 @@ namespace constexpr_list
 				std::ranges::swap(alloc_, other.alloc_);
 			}
 
-			if (this->empty())
+			if constexpr (heap_sentinel_)
+			{
+				std::ranges::swap(ptrs_, other.ptrs_);
+			}
+			else if (this->empty())
 			{
 				if (!other.empty())
 				{
 					this->ptrs_.next_ = other.ptrs_.next_;
-					this->ptrs_.next_->prev_ = &ptrs_;
+					this->ptrs_.next_->prev_ = this->sentinel_();
 					this->ptrs_.prev_ = other.ptrs_.prev_;
-					this->ptrs_.prev_->next_ = &ptrs_;
-					other.ptrs_ = { &other.ptrs_, &other.ptrs_ };
+					this->ptrs_.prev_->next_ = this->sentinel_();
+					other.ptrs_ = { other.sentinel_(), other.sentinel_() };
 				}
 			}
 			else if (other.empty())
 			{
 				other.ptrs_.next_ = this->ptrs_.next_;
-				other.ptrs_.next_->prev_ = &other.ptrs_;
+				other.ptrs_.next_->prev_ = other.sentinel_();
 				other.ptrs_.prev_ = this->ptrs_.prev_;
-				other.ptrs_.prev_->next_ = &other.ptrs_;
-				this->ptrs_ = { &ptrs_, &ptrs_ };
+				other.ptrs_.prev_->next_ = other.sentinel_();
+				this->ptrs_ = { this->sentinel_(), this->sentinel_() };
 			}
 			else
 			{
@@ -1063,14 +2700,71 @@ namespace constexpr_list
 			std::ranges::swap(size_, other.size_);
 		}
 
+		static constexpr std::size_t serialized_header_size = 3 * sizeof(std::uint64_t);
+
+		[[nodiscard]]
+		constexpr std::size_t serialized_size() const noexcept requires std::is_trivially_copyable_v<T>
+		{
+			return serialized_header_size + this->size() * sizeof(T);
+		}
+
+		constexpr std::span<std::byte> write_to(std::span<std::byte> out) const requires std::is_trivially_copyable_v<T>
+		{
+			const std::size_t total = this->serialized_size();
+
+			if (out.size() < total)
+			{
+				throw std::length_error("list::write_to: buffer too small");
+			}
+
+			std::byte* cursor = this->write_header_(out.data());
+
+			for (const T& value : *this)
+			{
+				detail::store_bytes(cursor, value);
+				cursor += sizeof(T);
+			}
+
+			return out.first(total);
+		}
+
+		[[nodiscard]]
+		static constexpr list load(std::span<const std::byte> in, const Allocator& alloc = Allocator())
+			requires std::is_trivially_copyable_v<T>
+		{
+			if (in.size() < serialized_header_size)
+			{
+				throw std::invalid_argument("list::load: truncated header");
+			}
+
+			const size_type count = read_header_(in.data());
+
+			if ((in.size() - serialized_header_size) / sizeof(T) < count)
+			{
+				throw std::invalid_argument("list::load: truncated elements");
+			}
+
+			list result(alloc);
+			result.append_bytes_(in.data() + serialized_header_size, count);
+			return result;
+		}
+
 		friend constexpr bool operator==(const list& lhs, const list& rhs)
 			noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>()))
 		{
+			if constexpr (detail::block_comparable<T>)
+			{
+				if !consteval
+				{
+					return equal_blocks_(lhs, rhs);
+				}
+			}
+
 			return std::ranges::equal(lhs, rhs);
 		}
 
-		friend constexpr detail::synth_three_way_result<T>
-			operator<=>(const list& lhs, const list& rhs)
+		friend constexpr auto operator<=>(const list& lhs, const list& rhs)
+			requires requires (const T& value) { detail::synth_three_way(value, value); }
 		{
 			return std::lexicographical_compare_three_way(
 				lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
@@ -1080,31 +2774,22 @@ namespace constexpr_list
 
 		constexpr ~list()
 		{
-			links_* current = ptrs_.next_;
-			while (size_)
+			if (!this->release_without_walk_())
 			{
-				links_* tmp = current->next_;
-
-				std::destroy_at(std::addressof(static_cast<node_*>(current)->storage_.value_));
-				traits::destroy(alloc_, static_cast<node_*>(current));
-				traits::deallocate(alloc_, static_cast<node_*>(current), 1);
+				this->destroy_chain_();
+			}
 
-				current = tmp;
-				--size_;
+			if constexpr (heap_sentinel_)
+			{
+				this->free_anchor_();
 			}
 		}
 
 	private:
-		struct node_;
-
-		using node_allocator = typename
-			std::allocator_traits<allocator_type>::template rebind_alloc<node_>;
-		using traits = typename std::allocator_traits<node_allocator>;
-
 		struct links_
 		{
-			links_* next_ = nullptr;
-			links_* prev_ = nullptr;
+			link_pointer next_ = nullptr;
+			link_pointer prev_ = nullptr;
 		};
 
 		struct node_ : links_
@@ -1167,14 +2852,7 @@ namespace constexpr_list
 
 			constexpr reference operator*() const noexcept
 			{
-				if constexpr (Const == true)
-				{
-					return static_cast<const node_* const>(ptrs_)->storage_.value_;
-				}
-				else
-				{
-					return static_cast<node_* const>(ptrs_)->storage_.value_;
-				}
+				return node_of_(ptrs_).storage_.value_;
 			}
 
 			constexpr iterator_base& operator++() noexcept
@@ -1203,9 +2881,9 @@ namespace constexpr_list
 				return tmp;
 			}
 
-			constexpr pointer operator->()
+			constexpr pointer operator->() const
 			{
-				return std::addressof(**this);
+				return detail::pointer_to<pointer>(**this);
 			}
 
 			friend constexpr bool operator==(const iterator_base& lhs, const iterator_base& rhs) noexcept
@@ -1215,43 +2893,37 @@ namespace constexpr_list
 
 		private:
 
-			constexpr iterator_base(links_* node) noexcept
-				requires (Const == false)
-			: ptrs_{ node }
-			{}
-
-			constexpr iterator_base(const links_* node) noexcept
-				requires (Const == true)
+			constexpr explicit iterator_base(link_pointer node) noexcept
 			: ptrs_{ node }
 			{}
 
-			std::conditional_t<Const,
-				const links_, links_>* ptrs_ = nullptr;
+			link_pointer ptrs_ = nullptr;
 		};
 
-		links_ ptrs_{ &ptrs_, &ptrs_ };
+		[[no_unique_address]] node_allocator alloc_;
+		std::conditional_t<heap_sentinel_, link_pointer, links_> ptrs_ = this->make_anchor_();
 		std::size_t size_{};
 
-		[[no_unique_address]] node_allocator alloc_;
+		[[no_unique_address]] stats_type stats_;
 	};
 
-	template <typename T, typename Alloc>
-	constexpr void swap(list<T, Alloc>& lhs, list<T, Alloc>& rhs)
+	template <typename T, typename Alloc, typename ... Policies>
+	constexpr void swap(list<T, Alloc, Policies...>& lhs, list<T, Alloc, Policies...>& rhs)
 		noexcept(noexcept(lhs.swap(rhs)))
 	{
 		lhs.swap(rhs);
 	}
 
-	template <typename T, typename Alloc, typename U>
-	constexpr auto erase(list<T, Alloc>& c, const U& value)
-		-> typename list<T, Alloc>::size_type
+	template <typename T, typename Alloc, typename ... Policies, typename U>
+	constexpr auto erase(list<T, Alloc, Policies...>& c, const U& value)
+		-> typename list<T, Alloc, Policies...>::size_type
 	{
 		return c.remove_if([&](auto& elem) { return elem == value; });
 	}
 
-	template <typename T, typename Alloc, typename Pred>
-	constexpr auto erase_if(list<T, Alloc>& c, Pred pred)
-		-> typename list<T, Alloc>::size_type
+	template <typename T, typename Alloc, typename ... Policies, typename Pred>
+	constexpr auto erase_if(list<T, Alloc, Policies...>& c, Pred pred)
+		-> typename list<T, Alloc, Policies...>::size_type
 	{
 		return c.remove_if(std::ref(pred));
 	}
@@ -1266,6 +2938,23 @@ namespace constexpr_list
 	list(std::from_range_t, R&&, Alloc = Alloc())
 		-> list<std::ranges::range_value_t<R>, Alloc>;
 
+	template <detail::execution_policy ExecutionPolicy, std::ranges::random_access_range R,
+		typename Alloc = std::allocator<std::ranges::range_value_t<R>>>
+	list(std::from_range_t, ExecutionPolicy&&, R&&, Alloc = Alloc())
+		-> list<std::ranges::range_value_t<R>, Alloc>;
+
+	template <typename T>
+	struct is_trivially_relocatable : std::is_trivially_copyable<T>
+	{};
+
+	template <typename T, typename Alloc, typename ... Policies>
+	struct is_trivially_relocatable<list<T, Alloc, Policies...>>
+		: std::bool_constant<list<T, Alloc, Policies...>::trivially_relocatable>
+	{};
+
+	template <typename T>
+	inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
 	static_assert(std::ranges::bidirectional_range<list<int>>);
 	static_assert(std::ranges::output_range<list<int>, int>);
 	static_assert(std::bidirectional_iterator<std::ranges::iterator_t<list<int>>>);
@@ -1276,12 +2965,19 @@ namespace constexpr_list
 	static_assert(std::is_move_constructible_v<list<int>>);
 	static_assert(std::is_move_assignable_v<list<int>>);
 	static_assert(std::is_destructible_v<list<int>>);
+	static_assert(!is_trivially_relocatable_v<list<int>>);
+	static_assert(is_trivially_relocatable_v<list<int, std::allocator<int>, heap_sentinel>>);
+	static_assert(is_concurrent_allocator_v<std::allocator<int>>);
 
 	namespace pmr
 	{
-		template <typename T>
-		using list = list<T, std::pmr::polymorphic_allocator<T>>;
+		template <typename T, typename ... Policies>
+		using list = list<T, std::pmr::polymorphic_allocator<T>, Policies...>;
 	}
 }
 
+template <typename T, typename Alloc, typename ... Policies>
+	requires std::same_as<typename constexpr_list::list<T, Alloc, Policies...>::size_policy, constexpr_list::lazy_size>
+inline constexpr bool std::ranges::disable_sized_range<constexpr_list::list<T, Alloc, Policies...>> = true;
+
 #endif // CONSTEXPR_LIST
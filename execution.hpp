@@ -0,0 +1,171 @@
+#ifndef CONSTEXPR_LIST_EXECUTION
+#define CONSTEXPR_LIST_EXECUTION
+
+#include <exception>
+#include <execution>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "constexpr_list.hpp"
+
+namespace constexpr_list::detail
+{
+	template <>
+	struct execution_traits<std::execution::sequenced_policy>
+	{
+		static constexpr bool is_policy = true;
+		static constexpr bool parallel = false;
+	};
+
+	template <>
+	struct execution_traits<std::execution::unsequenced_policy>
+	{
+		static constexpr bool is_policy = true;
+		static constexpr bool parallel = false;
+	};
+
+	template <>
+	struct execution_traits<std::execution::parallel_policy>
+	{
+		static constexpr bool is_policy = true;
+		static constexpr bool parallel = true;
+	};
+
+	template <>
+	struct execution_traits<std::execution::parallel_unsequenced_policy>
+	{
+		static constexpr bool is_policy = true;
+		static constexpr bool parallel = true;
+	};
+
+	template <typename List>
+	struct parallel_builder
+	{
+		using size_type = typename List::size_type;
+		using difference_type = typename List::difference_type;
+		using node_allocator = typename List::node_allocator;
+		using traits = typename List::traits;
+		using link_pointer = typename List::link_pointer;
+		using node_pointer = typename List::node_pointer;
+
+		static constexpr size_type grain = size_type{ 1 } << 14;
+
+		static void free_chain(node_allocator& alloc, link_pointer first, link_pointer last)
+		{
+			while (first)
+			{
+				link_pointer next = first == last ? nullptr : first->next_;
+				List::free_node_(alloc, first);
+				first = next;
+			}
+		}
+
+		template <typename It>
+		static std::pair<link_pointer, link_pointer> build_chain(node_allocator alloc, It it, size_type count)
+		{
+			link_pointer first = nullptr;
+			link_pointer last = nullptr;
+
+			try
+			{
+				for (; count; --count, ++it)
+				{
+					node_pointer new_node = traits::allocate(alloc, 1);
+
+					try
+					{
+						traits::construct(alloc, std::to_address(new_node), std::in_place, *it);
+					}
+					catch (...)
+					{
+						traits::deallocate(alloc, new_node, 1);
+						throw;
+					}
+
+					link_pointer link = List::link_of_(new_node);
+					(last ? last->next_ : first) = link;
+					link->prev_ = last;
+					last = link;
+				}
+			}
+			catch (...)
+			{
+				free_chain(alloc, first, last);
+				throw;
+			}
+
+			return { first, last };
+		}
+
+		template <typename It>
+		static void append(List& self, It first, size_type count)
+		{
+			if (count == 0)
+			{
+				return;
+			}
+
+			const size_type workers = std::clamp<size_type>(count / grain, 1,
+				std::max<size_type>(std::thread::hardware_concurrency(), 1));
+
+			std::vector<std::pair<link_pointer, link_pointer>> chains(workers);
+			std::vector<std::exception_ptr> errors(workers);
+
+			const auto segment = [&](size_type i)
+			{
+				const size_type begin = count * i / workers;
+				const size_type end = count * (i + 1) / workers;
+
+				try
+				{
+					chains[i] = build_chain(self.alloc_, first + static_cast<difference_type>(begin), end - begin);
+				}
+				catch (...)
+				{
+					errors[i] = std::current_exception();
+				}
+			};
+
+			{
+				std::vector<std::jthread> threads;
+				threads.reserve(workers - 1);
+
+				for (size_type i = 1; i < workers; ++i)
+				{
+					try
+					{
+						threads.emplace_back(segment, i);
+					}
+					catch (const std::system_error&)
+					{
+						segment(i);
+					}
+				}
+
+				segment(0);
+			}
+
+			if (const auto failed = std::ranges::find_if(errors, [](const std::exception_ptr& e) { return e != nullptr; });
+				failed != errors.end())
+			{
+				for (auto& [chain_first, chain_last] : chains)
+				{
+					free_chain(self.alloc_, chain_first, chain_last);
+				}
+
+				std::rethrow_exception(*failed);
+			}
+
+			for (auto& [chain_first, chain_last] : chains)
+			{
+				List::link_chain_(self.end(), chain_first, chain_last);
+			}
+
+			self.stats_.on_relink(workers);
+			self.grow_size_(count);
+		}
+	};
+}
+
+#endif // CONSTEXPR_LIST_EXECUTION
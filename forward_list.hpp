@@ -0,0 +1,978 @@
+#ifndef CONSTEXPR_LIST_FORWARD_LIST
+#define CONSTEXPR_LIST_FORWARD_LIST
+
+#include "constexpr_list.hpp"
+
+namespace constexpr_list
+{
+	template<
+		typename T,
+		typename Allocator = std::allocator<T>
+	>
+	class forward_list
+	{
+		template <bool Const>
+		struct iterator_base;
+		struct links_;
+		struct node_;
+
+		using node_allocator = typename
+			std::allocator_traits<Allocator>::template rebind_alloc<node_>;
+		using traits = typename std::allocator_traits<node_allocator>;
+		using node_pointer = typename traits::pointer;
+		using link_pointer = typename std::pointer_traits<
+			typename std::allocator_traits<Allocator>::void_pointer>::template rebind<links_>;
+
+		static_assert(!std::is_reference_v<T>, "T cannot be a reference type");
+		static_assert(!std::is_void_v<T>, "T cannot be void");
+		static_assert(std::is_destructible_v<T>, "T must be destructible");
+
+	public:
+		using value_type = T;
+		using allocator_type = Allocator;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using pointer = typename std::allocator_traits<Allocator>::pointer;
+		using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+		using iterator = iterator_base<false>;
+		using const_iterator = iterator_base<true>;
+
+		static constexpr bool trivially_relocatable =
+			(std::is_empty_v<node_allocator> || std::is_trivially_copyable_v<node_allocator>)
+			&& std::is_trivially_copyable_v<link_pointer>;
+
+		constexpr forward_list() noexcept = default;
+
+		explicit constexpr forward_list(const Allocator& alloc)
+			: alloc_(std::allocator_traits<allocator_type>::select_on_container_copy_construction(alloc))
+		{}
+
+		explicit constexpr forward_list(size_type count,
+			const allocator_type& alloc = allocator_type()) requires (std::is_default_constructible_v<T>)
+			: forward_list(alloc)
+		{
+			this->resize(count);
+		}
+
+		constexpr forward_list(size_type count, const T& value,
+			const allocator_type& alloc = allocator_type())
+			: forward_list(alloc)
+		{
+			this->insert_after(this->before_begin(), count, value);
+		}
+
+		template <std::input_iterator InputIt, std::sentinel_for<InputIt> S>
+			requires std::constructible_from<T, std::iter_reference_t<InputIt>>
+		constexpr forward_list(InputIt first, S last,
+			const Allocator& alloc = Allocator())
+			: forward_list(alloc)
+		{
+			this->insert_after(this->before_begin(), std::move(first), std::move(last));
+		}
+
+		template <detail::container_compatible_range<T> R>
+		constexpr forward_list(std::from_range_t, R&& rg,
+			const allocator_type& alloc = allocator_type())
+			: forward_list(alloc)
+		{
+			this->insert_range_after(this->before_begin(), std::forward<R>(rg));
+		}
+
+		constexpr forward_list(std::initializer_list<T> il,
+			const allocator_type& alloc = allocator_type())
+			: forward_list(il.begin(), il.end(), alloc)
+		{}
+
+		constexpr forward_list(const forward_list& other)
+			: forward_list(other.begin(), other.end(), other.get_allocator())
+		{}
+
+		constexpr forward_list(const forward_list& other, const allocator_type& alloc)
+			: forward_list(other.begin(), other.end(), alloc)
+		{}
+
+		constexpr forward_list(forward_list&& other) noexcept
+			: alloc_(std::move(other.alloc_))
+		{
+			this->steal_chain_(other);
+		}
+
+		constexpr forward_list(forward_list&& other, const allocator_type& alloc)
+			: forward_list(alloc)
+		{
+			if (std::allocator_traits<allocator_type>::is_always_equal::value || alloc_ == other.alloc_)
+			{
+				this->steal_chain_(other);
+			}
+			else
+			{
+				this->assign_range(other | std::views::as_rvalue);
+			}
+		}
+
+		constexpr forward_list& operator=(const forward_list& other)
+		{
+			if (this == &other)
+			{
+				return *this;
+			}
+
+			if constexpr (traits::propagate_on_container_copy_assignment::value)
+			{
+				if (alloc_ != other.alloc_)
+				{
+					this->clear();
+				}
+
+				alloc_ = other.alloc_;
+			}
+
+			this->assign(other.begin(), other.end());
+			return *this;
+		}
+
+		constexpr forward_list& operator=(forward_list&& other)
+			noexcept(traits::is_always_equal::value || traits::propagate_on_container_move_assignment::value)
+		{
+			if (this == &other)
+			{
+				return *this;
+			}
+
+			if constexpr (traits::is_always_equal::value || traits::propagate_on_container_move_assignment::value)
+			{
+				this->clear();
+
+				if constexpr (traits::propagate_on_container_move_assignment::value)
+				{
+					alloc_ = std::move(other.alloc_);
+				}
+
+				this->steal_chain_(other);
+			}
+			else if (alloc_ == other.alloc_)
+			{
+				this->clear();
+				this->steal_chain_(other);
+			}
+			else
+			{
+				this->assign_range(other | std::views::as_rvalue);
+			}
+
+			return *this;
+		}
+
+		constexpr forward_list& operator=(std::initializer_list<T> ilist)
+		{
+			this->assign_range(ilist);
+			return *this;
+		}
+
+		constexpr ~forward_list()
+		{
+			if constexpr (detail::skips_deallocation<node_allocator> && std::is_trivially_destructible_v<T>)
+			{
+				if !consteval
+				{
+					return;
+				}
+			}
+
+			this->free_chain_(head_.next_);
+		}
+
+		constexpr void assign(size_type count, const T& value)
+		{
+			link_pointer prev = this->before_begin_();
+
+			for (; count != 0 && prev->next_; --count)
+			{
+				prev = prev->next_;
+				node_of_(prev).storage_.value_ = value;
+			}
+
+			if (count != 0)
+			{
+				this->insert_after(const_iterator{ prev }, count, value);
+			}
+			else
+			{
+				this->erase_after(const_iterator{ prev }, this->end());
+			}
+		}
+
+		template <std::input_iterator InputIt, std::sentinel_for<InputIt> S>
+			requires (std::is_constructible_v<T, std::iter_reference_t<InputIt>> && std::is_assignable_v<T&, std::iter_reference_t<InputIt>>)
+		constexpr void assign(InputIt first, S last)
+		{
+			link_pointer prev = this->before_begin_();
+
+			for (; first != last && prev->next_; ++first)
+			{
+				prev = prev->next_;
+				node_of_(prev).storage_.value_ = *first;
+			}
+
+			if (first != last)
+			{
+				this->insert_after(const_iterator{ prev }, std::move(first), std::move(last));
+			}
+			else
+			{
+				this->erase_after(const_iterator{ prev }, this->end());
+			}
+		}
+
+		constexpr void assign(std::initializer_list<T> ilist)
+		{
+			this->assign_range(ilist);
+		}
+
+		template <detail::container_compatible_range<T> R>
+		constexpr void assign_range(R&& rg)
+		{
+			this->assign(std::ranges::begin(rg), std::ranges::end(rg));
+		}
+
+		constexpr allocator_type get_allocator() const noexcept
+		{
+			return static_cast<allocator_type>(alloc_);
+		}
+
+		constexpr reference front()
+		{
+			return node_of_(head_.next_).storage_.value_;
+		}
+
+		constexpr const_reference front() const
+		{
+			return node_of_(head_.next_).storage_.value_;
+		}
+
+		constexpr iterator before_begin() noexcept
+		{
+			return iterator{ this->before_begin_() };
+		}
+
+		constexpr const_iterator before_begin() const noexcept
+		{
+			return const_iterator{ this->before_begin_() };
+		}
+
+		constexpr const_iterator cbefore_begin() const noexcept
+		{
+			return this->before_begin();
+		}
+
+		constexpr iterator begin() noexcept
+		{
+			return iterator{ head_.next_ };
+		}
+
+		constexpr const_iterator begin() const noexcept
+		{
+			return const_iterator{ head_.next_ };
+		}
+
+		constexpr const_iterator cbegin() const noexcept
+		{
+			return this->begin();
+		}
+
+		constexpr iterator end() noexcept
+		{
+			return iterator{};
+		}
+
+		constexpr const_iterator end() const noexcept
+		{
+			return const_iterator{};
+		}
+
+		constexpr const_iterator cend() const noexcept
+		{
+			return this->end();
+		}
+
+		[[nodiscard]]
+		constexpr bool empty() const noexcept
+		{
+			return head_.next_ == nullptr;
+		}
+
+		[[nodiscard]]
+		constexpr size_type max_size() const noexcept
+		{
+			return traits::max_size(alloc_);
+		}
+
+		constexpr void clear() noexcept
+		{
+			this->free_chain_(std::exchange(head_.next_, nullptr));
+		}
+
+		constexpr iterator insert_after(const_iterator pos, const T& value)
+		{
+			return this->emplace_after(pos, value);
+		}
+
+		constexpr iterator insert_after(const_iterator pos, T&& value)
+		{
+			return this->emplace_after(pos, std::move(value));
+		}
+
+		constexpr iterator insert_after(const_iterator pos, size_type count, const T& value)
+		{
+			for (; count != 0; --count)
+			{
+				pos = this->emplace_after(pos, value);
+			}
+
+			return iterator{ pos.ptr_ };
+		}
+
+		template <std::input_iterator InputIt, std::sentinel_for<InputIt> S>
+			requires std::constructible_from<T, std::iter_reference_t<InputIt>>
+		constexpr iterator insert_after(const_iterator pos, InputIt first, S last)
+		{
+			for (; first != last; ++first)
+			{
+				pos = this->emplace_after(pos, *first);
+			}
+
+			return iterator{ pos.ptr_ };
+		}
+
+		constexpr iterator insert_after(const_iterator pos, std::initializer_list<T> ilist)
+		{
+			return this->insert_after(pos, ilist.begin(), ilist.end());
+		}
+
+		template <detail::container_compatible_range<T> R>
+		constexpr iterator insert_range_after(const_iterator pos, R&& rg)
+		{
+			return this->insert_after(pos, std::ranges::begin(rg), std::ranges::end(rg));
+		}
+
+		template <typename ... Args> requires std::constructible_from<T, Args...>
+		constexpr iterator emplace_after(const_iterator pos, Args&& ... args)
+		{
+			link_pointer node = this->make_node_(std::forward<Args>(args)...);
+			node->next_ = pos.ptr_->next_;
+			pos.ptr_->next_ = node;
+			return iterator{ node };
+		}
+
+		constexpr iterator erase_after(const_iterator pos) noexcept
+		{
+			link_pointer victim = pos.ptr_->next_;
+			pos.ptr_->next_ = victim->next_;
+			this->free_node_(victim);
+			return iterator{ pos.ptr_->next_ };
+		}
+
+		constexpr iterator erase_after(const_iterator first, const_iterator last) noexcept
+		{
+			while (first.ptr_->next_ != last.ptr_)
+			{
+				this->erase_after(first);
+			}
+
+			return iterator{ last.ptr_ };
+		}
+
+		constexpr void push_front(const T& value)
+		{
+			this->emplace_front(value);
+		}
+
+		constexpr void push_front(T&& value)
+		{
+			this->emplace_front(std::move(value));
+		}
+
+		template <typename ... Args> requires std::constructible_from<T, Args...>
+		constexpr reference emplace_front(Args&& ... args)
+		{
+			return *this->emplace_after(this->before_begin(), std::forward<Args>(args)...);
+		}
+
+		template <detail::container_compatible_range<T> R>
+		constexpr void prepend_range(R&& rg)
+		{
+			this->insert_range_after(this->before_begin(), std::forward<R>(rg));
+		}
+
+		constexpr void pop_front() noexcept
+		{
+			this->erase_after(this->before_begin());
+		}
+
+		constexpr void resize(size_type count) requires (std::is_default_constructible_v<T>)
+		{
+			link_pointer prev = this->before_begin_();
+
+			for (; count != 0 && prev->next_; --count)
+			{
+				prev = prev->next_;
+			}
+
+			for (; count != 0; --count)
+			{
+				prev = this->emplace_after(const_iterator{ prev }).ptr_;
+			}
+
+			this->erase_after(const_iterator{ prev }, this->end());
+		}
+
+		constexpr void resize(size_type count, const value_type& value)
+		{
+			link_pointer prev = this->before_begin_();
+
+			for (; count != 0 && prev->next_; --count)
+			{
+				prev = prev->next_;
+			}
+
+			prev = this->insert_after(const_iterator{ prev }, count, value).ptr_;
+			this->erase_after(const_iterator{ prev }, this->end());
+		}
+
+		constexpr void swap(forward_list& other) noexcept
+		{
+			if constexpr (traits::propagate_on_container_swap::value)
+			{
+				std::ranges::swap(alloc_, other.alloc_);
+			}
+
+			std::ranges::swap(head_.next_, other.head_.next_);
+		}
+
+		template <typename Compare>
+		constexpr void merge(forward_list&& other, Compare comp)
+		{
+			if (this != &other)
+			{
+				merge_chains_(head_.next_, other.head_.next_, comp);
+			}
+		}
+
+		template <typename Compare>
+		constexpr void merge(forward_list& other, Compare comp)
+		{
+			this->merge(std::move(other), std::ref(comp));
+		}
+
+		constexpr void merge(forward_list& other)
+		{
+			this->merge(std::move(other), std::less{});
+		}
+
+		constexpr void merge(forward_list&& other)
+		{
+			this->merge(std::move(other), std::less{});
+		}
+
+		constexpr void splice_after(const_iterator pos, forward_list&& other) noexcept
+		{
+			if (other.empty())
+			{
+				return;
+			}
+
+			link_pointer last = other.head_.next_;
+
+			while (last->next_)
+			{
+				last = last->next_;
+			}
+
+			last->next_ = pos.ptr_->next_;
+			pos.ptr_->next_ = std::exchange(other.head_.next_, nullptr);
+		}
+
+		constexpr void splice_after(const_iterator pos, forward_list& other) noexcept
+		{
+			this->splice_after(pos, std::move(other));
+		}
+
+		constexpr void splice_after(const_iterator pos, forward_list&&, const_iterator it) noexcept
+		{
+			link_pointer node = it.ptr_->next_;
+
+			if (!node || pos == it || pos.ptr_ == node)
+			{
+				return;
+			}
+
+			it.ptr_->next_ = node->next_;
+			node->next_ = pos.ptr_->next_;
+			pos.ptr_->next_ = node;
+		}
+
+		constexpr void splice_after(const_iterator pos, forward_list& other, const_iterator it) noexcept
+		{
+			this->splice_after(pos, std::move(other), it);
+		}
+
+		constexpr void splice_after(const_iterator pos, forward_list&&, const_iterator first, const_iterator last) noexcept
+		{
+			link_pointer chain = first.ptr_->next_;
+
+			if (chain == last.ptr_)
+			{
+				return;
+			}
+
+			link_pointer tail = chain;
+
+			while (tail->next_ != last.ptr_)
+			{
+				tail = tail->next_;
+			}
+
+			first.ptr_->next_ = last.ptr_;
+			tail->next_ = pos.ptr_->next_;
+			pos.ptr_->next_ = chain;
+		}
+
+		constexpr void splice_after(const_iterator pos, forward_list& other, const_iterator first, const_iterator last) noexcept
+		{
+			this->splice_after(pos, std::move(other), first, last);
+		}
+
+		template <typename U> requires std::equality_comparable_with<const T&, const U&>
+		constexpr size_type remove(const U& value)
+		{
+			return this->remove_if([&](const T& elem) { return elem == value; });
+		}
+
+		template <typename UnaryPredicate>
+		constexpr size_type remove_if(UnaryPredicate p)
+		{
+			link_pointer removed = nullptr;
+			link_pointer* removed_tail = std::addressof(removed);
+			size_type counter = 0;
+
+			const auto release = [&]
+			{
+				*removed_tail = nullptr;
+				this->free_chain_(removed);
+			};
+
+			try
+			{
+				for (link_pointer prev = this->before_begin_(); prev->next_;)
+				{
+					link_pointer node = prev->next_;
+
+					if (static_cast<bool>(std::invoke(p, std::as_const(node_of_(node).storage_.value_))))
+					{
+						prev->next_ = node->next_;
+						*removed_tail = node;
+						removed_tail = std::addressof(node->next_);
+						++counter;
+					}
+					else
+					{
+						prev = node;
+					}
+				}
+			}
+			catch (...)
+			{
+				release();
+				throw;
+			}
+
+			release();
+			return counter;
+		}
+
+		constexpr void reverse() noexcept
+		{
+			link_pointer reversed = nullptr;
+			link_pointer node = head_.next_;
+
+			while (node)
+			{
+				link_pointer next = node->next_;
+				node->next_ = reversed;
+				reversed = node;
+				node = next;
+			}
+
+			head_.next_ = reversed;
+		}
+
+		template <typename BinaryPredicate>
+		constexpr size_type unique(BinaryPredicate p)
+		{
+			size_type counter = 0;
+
+			if (this->empty())
+			{
+				return counter;
+			}
+
+			for (link_pointer kept = head_.next_; kept->next_;)
+			{
+				if (static_cast<bool>(std::invoke(p, std::as_const(node_of_(kept).storage_.value_),
+					std::as_const(node_of_(kept->next_).storage_.value_))))
+				{
+					this->erase_after(const_iterator{ kept });
+					++counter;
+				}
+				else
+				{
+					kept = kept->next_;
+				}
+			}
+
+			return counter;
+		}
+
+		constexpr size_type unique()
+		{
+			return this->unique(std::equal_to{});
+		}
+
+		template <typename Compare>
+		constexpr void sort(Compare comp)
+		{
+			std::array<link_pointer, 64> bins{};
+			link_pointer rest = std::exchange(head_.next_, nullptr);
+			link_pointer carry = nullptr;
+
+			try
+			{
+				while (rest)
+				{
+					carry = rest;
+					rest = rest->next_;
+					carry->next_ = nullptr;
+
+					std::size_t bin = 0;
+
+					for (; bins[bin]; ++bin)
+					{
+						merge_chains_(bins[bin], carry, comp);
+						carry = std::exchange(bins[bin], nullptr);
+					}
+
+					bins[bin] = std::exchange(carry, nullptr);
+				}
+
+				for (link_pointer& bin : bins)
+				{
+					if (bin)
+					{
+						merge_chains_(bin, carry, comp);
+						carry = std::exchange(bin, nullptr);
+					}
+				}
+
+				head_.next_ = carry;
+			}
+			catch (...)
+			{
+				link_pointer* tail = std::addressof(head_.next_);
+
+				for (link_pointer chain : bins)
+				{
+					append_chain_(tail, chain);
+				}
+
+				append_chain_(tail, carry);
+				append_chain_(tail, rest);
+				throw;
+			}
+		}
+
+		constexpr void sort()
+		{
+			this->sort(std::less{});
+		}
+
+		friend constexpr bool operator==(const forward_list& lhs, const forward_list& rhs)
+			noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>()))
+		{
+			return std::ranges::equal(lhs, rhs);
+		}
+
+		friend constexpr auto operator<=>(const forward_list& lhs, const forward_list& rhs)
+			requires requires (const T& value) { detail::synth_three_way(value, value); }
+		{
+			return std::lexicographical_compare_three_way(
+				lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+				detail::synth_three_way
+			);
+		}
+
+	private:
+		constexpr link_pointer before_begin_() const noexcept
+		{
+			return detail::pointer_to<link_pointer>(const_cast<links_&>(head_));
+		}
+
+		constexpr void steal_chain_(forward_list& other) noexcept
+		{
+			head_.next_ = std::exchange(other.head_.next_, nullptr);
+		}
+
+		template <typename ... Args>
+		constexpr link_pointer make_node_(Args&& ... args)
+		{
+			node_pointer node = traits::allocate(alloc_, 1);
+
+			try
+			{
+				traits::construct(alloc_, std::to_address(node), std::in_place, std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				traits::deallocate(alloc_, node, 1);
+				throw;
+			}
+
+			return link_of_(node);
+		}
+
+		constexpr void free_node_(link_pointer link) noexcept
+		{
+			node_pointer node = node_pointer_of_(link);
+			std::destroy_at(std::addressof(node->storage_.value_));
+			traits::destroy(alloc_, std::to_address(node));
+			traits::deallocate(alloc_, node, 1);
+		}
+
+		constexpr void free_chain_(link_pointer chain) noexcept
+		{
+			while (chain)
+			{
+				this->free_node_(std::exchange(chain, chain->next_));
+			}
+		}
+
+		static constexpr void append_chain_(link_pointer*& tail, link_pointer chain) noexcept
+		{
+			while (*tail)
+			{
+				tail = std::addressof((*tail)->next_);
+			}
+
+			*tail = chain;
+		}
+
+		template <typename Compare>
+		static constexpr void merge_chains_(link_pointer& into, link_pointer& from, Compare& comp)
+		{
+			link_pointer* pos = std::addressof(into);
+
+			try
+			{
+				while (*pos && from)
+				{
+					if (std::invoke(comp, std::as_const(node_of_(from).storage_.value_),
+						std::as_const(node_of_(*pos).storage_.value_)))
+					{
+						link_pointer next = from->next_;
+						from->next_ = *pos;
+						*pos = std::exchange(from, next);
+					}
+
+					pos = std::addressof((*pos)->next_);
+				}
+			}
+			catch (...)
+			{
+				append_chain_(pos, std::exchange(from, nullptr));
+				throw;
+			}
+
+			append_chain_(pos, std::exchange(from, nullptr));
+		}
+
+		static constexpr link_pointer link_of_(node_pointer node) noexcept
+		{
+			if constexpr (std::is_convertible_v<node_pointer, link_pointer>)
+			{
+				return node;
+			}
+			else
+			{
+				return detail::pointer_to<link_pointer>(*node);
+			}
+		}
+
+		static constexpr node_pointer node_pointer_of_(link_pointer link) noexcept
+		{
+			if constexpr (std::is_pointer_v<link_pointer>)
+			{
+				return static_cast<node_*>(link);
+			}
+			else
+			{
+				return detail::pointer_to<node_pointer>(node_of_(link));
+			}
+		}
+
+		static constexpr node_& node_of_(link_pointer link) noexcept
+		{
+			return static_cast<node_&>(*link);
+		}
+
+		struct links_
+		{
+			link_pointer next_ = nullptr;
+		};
+
+		struct node_ : links_
+		{
+			constexpr node_() = default;
+
+			template <typename ... Args>
+			constexpr node_(std::in_place_t, Args&& ... args)
+			{
+				std::construct_at(std::addressof(storage_.value_),
+					std::forward<Args>(args)...);
+			}
+
+			union storage_t
+			{
+				constexpr storage_t() noexcept {};
+
+				constexpr ~storage_t()
+					requires std::is_trivially_destructible_v<value_type>
+				= default;
+
+				constexpr ~storage_t() noexcept {}
+
+				value_type value_;
+			} storage_;
+		};
+
+		template <bool Const>
+		struct iterator_base
+		{
+			friend struct iterator_base<!Const>;
+			friend class forward_list;
+
+			using difference_type = typename forward_list::difference_type;
+			using value_type = T;
+			using pointer = std::conditional_t<Const, typename forward_list::const_pointer,
+				typename forward_list::pointer>;
+			using reference = std::conditional_t<Const, typename forward_list::const_reference,
+				typename forward_list::reference>;
+			using iterator_category = std::forward_iterator_tag;
+			using iterator_concept = std::forward_iterator_tag;
+
+			constexpr iterator_base() noexcept = default;
+
+			constexpr iterator_base(const iterator_base& other) noexcept = default;
+			constexpr iterator_base& operator=(const iterator_base& other) noexcept = default;
+
+			constexpr iterator_base(const iterator_base<false>& other) noexcept
+				requires (Const == true)
+			: ptr_{ other.ptr_ }
+			{}
+
+			constexpr iterator_base& operator=(const iterator_base<false>& other) noexcept
+				requires (Const == true)
+			{
+				ptr_ = other.ptr_;
+				return *this;
+			}
+
+			constexpr reference operator*() const noexcept
+			{
+				return node_of_(ptr_).storage_.value_;
+			}
+
+			constexpr pointer operator->() const
+			{
+				return detail::pointer_to<pointer>(**this);
+			}
+
+			constexpr iterator_base& operator++() noexcept
+			{
+				ptr_ = ptr_->next_;
+				return *this;
+			}
+
+			constexpr iterator_base operator++(int) noexcept
+			{
+				auto tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			friend constexpr bool operator==(const iterator_base& lhs, const iterator_base& rhs) noexcept
+			{
+				return lhs.ptr_ == rhs.ptr_;
+			}
+
+		private:
+			constexpr explicit iterator_base(link_pointer node) noexcept
+			: ptr_{ node }
+			{}
+
+			link_pointer ptr_ = nullptr;
+		};
+
+		[[no_unique_address]] node_allocator alloc_;
+		links_ head_;
+	};
+
+	template <typename T, typename Alloc>
+	constexpr void swap(forward_list<T, Alloc>& lhs, forward_list<T, Alloc>& rhs)
+		noexcept(noexcept(lhs.swap(rhs)))
+	{
+		lhs.swap(rhs);
+	}
+
+	template <typename T, typename Alloc, typename U>
+	constexpr auto erase(forward_list<T, Alloc>& c, const U& value)
+		-> typename forward_list<T, Alloc>::size_type
+	{
+		return c.remove_if([&](auto& elem) { return elem == value; });
+	}
+
+	template <typename T, typename Alloc, typename Pred>
+	constexpr auto erase_if(forward_list<T, Alloc>& c, Pred pred)
+		-> typename forward_list<T, Alloc>::size_type
+	{
+		return c.remove_if(std::ref(pred));
+	}
+
+	template <typename InputIt,
+		typename Alloc = std::allocator<typename std::iterator_traits<InputIt>::value_type>>
+	forward_list(InputIt, InputIt, Alloc = Alloc())
+		->forward_list<typename std::iterator_traits<InputIt>::value_type, Alloc>;
+
+	template <std::ranges::input_range R,
+		typename Alloc = std::allocator<std::ranges::range_value_t<R>>>
+	forward_list(std::from_range_t, R&&, Alloc = Alloc())
+		-> forward_list<std::ranges::range_value_t<R>, Alloc>;
+
+	template <typename T, typename Alloc>
+	struct is_trivially_relocatable<forward_list<T, Alloc>>
+		: std::bool_constant<forward_list<T, Alloc>::trivially_relocatable>
+	{};
+
+	static_assert(std::ranges::forward_range<forward_list<int>>);
+	static_assert(std::forward_iterator<std::ranges::iterator_t<forward_list<int>>>);
+	static_assert(!std::ranges::sized_range<forward_list<int>>);
+	static_assert(is_trivially_relocatable_v<forward_list<int>>);
+
+	namespace pmr
+	{
+		template <typename T>
+		using forward_list = forward_list<T, std::pmr::polymorphic_allocator<T>>;
+	}
+}
+
+#endif // CONSTEXPR_LIST_FORWARD_LIST
@@ -0,0 +1,461 @@
+#ifndef CONSTEXPR_LIST_HOT_COLD_LIST
+#define CONSTEXPR_LIST_HOT_COLD_LIST
+
+#include "constexpr_list.hpp"
+
+namespace constexpr_list
+{
+	template <
+		typename T,
+		typename Projection,
+		typename Allocator = std::allocator<T>,
+		typename ColdAllocator = Allocator
+	>
+	class hot_cold_list
+	{
+		using cold_allocator = typename
+			std::allocator_traits<ColdAllocator>::template rebind_alloc<T>;
+		using cold_traits = std::allocator_traits<cold_allocator>;
+		using cold_pointer = typename cold_traits::pointer;
+
+	public:
+		using value_type = T;
+		using key_type = std::remove_cvref_t<std::invoke_result_t<const Projection&, const T&>>;
+		using projection_type = Projection;
+		using allocator_type = Allocator;
+		using cold_allocator_type = ColdAllocator;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+
+	private:
+		struct hot_entry_
+		{
+			key_type key_;
+			cold_pointer cold_;
+		};
+
+		using hot_allocator = typename
+			std::allocator_traits<Allocator>::template rebind_alloc<hot_entry_>;
+		using hot_list = list<hot_entry_, hot_allocator>;
+
+		template <bool Const>
+		struct iterator_base;
+
+	public:
+		using iterator = iterator_base<false>;
+		using const_iterator = iterator_base<true>;
+
+		constexpr hot_cold_list() = default;
+
+		explicit constexpr hot_cold_list(const Allocator& alloc)
+			requires std::constructible_from<cold_allocator, const Allocator&>
+			: hot_cold_list(Projection(), alloc, cold_allocator(alloc))
+		{}
+
+		explicit constexpr hot_cold_list(const Projection& projection, const Allocator& alloc = Allocator())
+			requires std::constructible_from<cold_allocator, const Allocator&>
+			: hot_cold_list(projection, alloc, cold_allocator(alloc))
+		{}
+
+		constexpr hot_cold_list(const Projection& projection, const Allocator& alloc, const ColdAllocator& cold_alloc)
+			: alloc_(cold_alloc)
+			, hot_(hot_allocator(alloc))
+			, projection_(projection)
+		{}
+
+		constexpr hot_cold_list(std::initializer_list<T> ilist,
+			const Projection& projection = Projection(),
+			const Allocator& alloc = Allocator())
+			requires std::constructible_from<cold_allocator, const Allocator&>
+			: hot_cold_list(projection, alloc)
+		{
+			for (const T& value : ilist)
+			{
+				this->emplace_back(value);
+			}
+		}
+
+		constexpr hot_cold_list(const hot_cold_list& other)
+			: hot_cold_list(other.projection_,
+				std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator()),
+				cold_traits::select_on_container_copy_construction(other.alloc_))
+		{
+			for (const T& value : other)
+			{
+				this->emplace_back(value);
+			}
+		}
+
+		constexpr hot_cold_list(hot_cold_list&& other) noexcept
+			: alloc_(other.alloc_)
+			, hot_(std::move(other.hot_))
+			, projection_(std::move(other.projection_))
+		{}
+
+		constexpr hot_cold_list& operator=(const hot_cold_list& other)
+		{
+			if (this != &other)
+			{
+				hot_cold_list copy(other);
+				this->swap(copy);
+			}
+
+			return *this;
+		}
+
+		constexpr hot_cold_list& operator=(hot_cold_list&& other) noexcept
+		{
+			if (this != &other)
+			{
+				this->clear();
+				this->swap(other);
+			}
+
+			return *this;
+		}
+
+		constexpr ~hot_cold_list()
+		{
+			this->clear();
+		}
+
+		template <typename ... Args> requires std::constructible_from<T, Args...>
+		constexpr iterator emplace(const_iterator pos, Args&& ... args)
+		{
+			cold_pointer cold = cold_traits::allocate(alloc_, 1);
+
+			try
+			{
+				cold_traits::construct(alloc_, std::to_address(cold), std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				cold_traits::deallocate(alloc_, cold, 1);
+				throw;
+			}
+
+			try
+			{
+				return iterator{ hot_.emplace(pos.hot_, std::invoke(projection_, std::as_const(*cold)), cold) };
+			}
+			catch (...)
+			{
+				this->destroy_cold_(cold);
+				throw;
+			}
+		}
+
+		template <typename ... Args> requires std::constructible_from<T, Args...>
+		constexpr const_reference emplace_back(Args&& ... args)
+		{
+			return *this->emplace(this->end(), std::forward<Args>(args)...).hot_->cold_;
+		}
+
+		template <typename ... Args> requires std::constructible_from<T, Args...>
+		constexpr const_reference emplace_front(Args&& ... args)
+		{
+			return *this->emplace(this->begin(), std::forward<Args>(args)...).hot_->cold_;
+		}
+
+		constexpr iterator insert(const_iterator pos, const T& value)
+		{
+			return this->emplace(pos, value);
+		}
+
+		constexpr iterator insert(const_iterator pos, T&& value)
+		{
+			return this->emplace(pos, std::move(value));
+		}
+
+		constexpr void push_back(const T& value)
+		{
+			this->emplace_back(value);
+		}
+
+		constexpr void push_back(T&& value)
+		{
+			this->emplace_back(std::move(value));
+		}
+
+		constexpr void push_front(const T& value)
+		{
+			this->emplace_front(value);
+		}
+
+		constexpr void push_front(T&& value)
+		{
+			this->emplace_front(std::move(value));
+		}
+
+		constexpr iterator erase(const_iterator pos)
+		{
+			this->destroy_cold_(pos.hot_->cold_);
+			return iterator{ hot_.erase(pos.hot_) };
+		}
+
+		constexpr void pop_front()
+		{
+			this->erase(this->begin());
+		}
+
+		constexpr void pop_back()
+		{
+			this->erase(std::ranges::prev(this->end()));
+		}
+
+		constexpr void clear() noexcept
+		{
+			for (hot_entry_& entry : hot_)
+			{
+				this->destroy_cold_(entry.cold_);
+			}
+
+			hot_.clear();
+		}
+
+		template <typename F>
+		constexpr void modify(iterator pos, F f)
+		{
+			std::invoke(f, *pos.hot_->cold_);
+			pos.hot_->key_ = std::invoke(projection_, std::as_const(*pos.hot_->cold_));
+		}
+
+		constexpr void splice(const_iterator pos, hot_cold_list& other)
+		{
+			hot_.splice(pos.hot_, other.hot_);
+		}
+
+		constexpr void splice(const_iterator pos, hot_cold_list& other, const_iterator it)
+		{
+			hot_.splice(pos.hot_, other.hot_, it.hot_);
+		}
+
+		template <typename Compare>
+		constexpr void sort(Compare comp)
+		{
+			hot_.sort([&](const hot_entry_& lhs, const hot_entry_& rhs) { return std::invoke(comp, lhs.key_, rhs.key_); });
+		}
+
+		constexpr void sort()
+		{
+			this->sort(std::less{});
+		}
+
+		template <typename Compare>
+		constexpr void merge(hot_cold_list& other, Compare comp)
+		{
+			hot_.merge(other.hot_, [&](const hot_entry_& lhs, const hot_entry_& rhs) { return std::invoke(comp, lhs.key_, rhs.key_); });
+		}
+
+		constexpr void merge(hot_cold_list& other)
+		{
+			this->merge(other, std::less{});
+		}
+
+		template <typename BinaryPredicate>
+		constexpr size_type unique(BinaryPredicate p)
+		{
+			size_type removed = 0;
+
+			if (hot_.empty())
+			{
+				return removed;
+			}
+
+			for (auto last = hot_.begin(), it = std::ranges::next(last); it != hot_.end();)
+			{
+				if (std::invoke(p, last->key_, it->key_))
+				{
+					this->destroy_cold_(it->cold_);
+					it = hot_.erase(it);
+					++removed;
+				}
+				else
+				{
+					last = it++;
+				}
+			}
+
+			return removed;
+		}
+
+		constexpr size_type unique()
+		{
+			return this->unique(std::equal_to{});
+		}
+
+		constexpr void swap(hot_cold_list& other) noexcept
+		{
+			std::ranges::swap(alloc_, other.alloc_);
+			hot_.swap(other.hot_);
+			std::ranges::swap(projection_, other.projection_);
+		}
+
+		constexpr iterator begin() noexcept
+		{
+			return iterator{ hot_.begin() };
+		}
+
+		constexpr const_iterator begin() const noexcept
+		{
+			return const_iterator{ hot_.begin() };
+		}
+
+		constexpr const_iterator cbegin() const noexcept
+		{
+			return this->begin();
+		}
+
+		constexpr iterator end() noexcept
+		{
+			return iterator{ hot_.end() };
+		}
+
+		constexpr const_iterator end() const noexcept
+		{
+			return const_iterator{ hot_.end() };
+		}
+
+		constexpr const_iterator cend() const noexcept
+		{
+			return this->end();
+		}
+
+		constexpr const_reference front() const
+		{
+			return *this->begin();
+		}
+
+		constexpr const_reference back() const
+		{
+			return *std::ranges::prev(this->end());
+		}
+
+		[[nodiscard]]
+		constexpr size_type size() const noexcept
+		{
+			return hot_.size();
+		}
+
+		[[nodiscard]]
+		constexpr bool empty() const noexcept
+		{
+			return hot_.empty();
+		}
+
+		constexpr allocator_type get_allocator() const noexcept
+		{
+			return static_cast<allocator_type>(hot_.get_allocator());
+		}
+
+		constexpr cold_allocator_type get_cold_allocator() const noexcept
+		{
+			return static_cast<cold_allocator_type>(alloc_);
+		}
+
+		constexpr const projection_type& projection() const noexcept
+		{
+			return projection_;
+		}
+
+		friend constexpr bool operator==(const hot_cold_list& lhs, const hot_cold_list& rhs)
+		{
+			return std::ranges::equal(lhs, rhs);
+		}
+
+	private:
+		constexpr void destroy_cold_(cold_pointer cold) noexcept
+		{
+			cold_traits::destroy(alloc_, std::to_address(cold));
+			cold_traits::deallocate(alloc_, cold, 1);
+		}
+
+		template <bool Const>
+		struct iterator_base
+		{
+			friend struct iterator_base<!Const>;
+			friend class hot_cold_list;
+
+			using hot_iterator = std::conditional_t<Const, typename hot_list::const_iterator,
+				typename hot_list::iterator>;
+
+			using difference_type = typename hot_cold_list::difference_type;
+			using value_type = T;
+			using pointer = const T*;
+			using reference = const T&;
+			using iterator_category = std::bidirectional_iterator_tag;
+			using iterator_concept = std::bidirectional_iterator_tag;
+
+			constexpr iterator_base() noexcept = default;
+
+			constexpr iterator_base(const iterator_base& other) noexcept = default;
+			constexpr iterator_base& operator=(const iterator_base& other) noexcept = default;
+
+			constexpr iterator_base(const iterator_base<false>& other) noexcept
+				requires (Const == true)
+			: hot_{ other.hot_ }
+			{}
+
+			constexpr reference operator*() const noexcept
+			{
+				return *hot_->cold_;
+			}
+
+			constexpr pointer operator->() const noexcept
+			{
+				return std::to_address(hot_->cold_);
+			}
+
+			constexpr const key_type& key() const noexcept
+			{
+				return hot_->key_;
+			}
+
+			constexpr iterator_base& operator++() noexcept
+			{
+				++hot_;
+				return *this;
+			}
+
+			constexpr iterator_base operator++(int) noexcept
+			{
+				auto tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			constexpr iterator_base& operator--() noexcept
+			{
+				--hot_;
+				return *this;
+			}
+
+			constexpr iterator_base operator--(int) noexcept
+			{
+				auto tmp = *this;
+				--(*this);
+				return tmp;
+			}
+
+			friend constexpr bool operator==(const iterator_base& lhs, const iterator_base& rhs) noexcept
+			{
+				return lhs.hot_ == rhs.hot_;
+			}
+
+		private:
+			constexpr explicit iterator_base(hot_iterator hot) noexcept
+				: hot_{ hot }
+			{}
+
+			hot_iterator hot_;
+		};
+
+		[[no_unique_address]] cold_allocator alloc_;
+		hot_list hot_;
+		[[no_unique_address]] Projection projection_;
+	};
+}
+
+#endif // CONSTEXPR_LIST_HOT_COLD_LIST
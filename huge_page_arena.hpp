@@ -0,0 +1,72 @@
+#ifndef CONSTEXPR_LIST_HUGE_PAGE_ARENA
+#define CONSTEXPR_LIST_HUGE_PAGE_ARENA
+
+#include <cerrno>
+#include <system_error>
+
+#include <sys/mman.h>
+
+#include "arena.hpp"
+
+namespace constexpr_list
+{
+	template <bool HugePages>
+	struct mmap_block_source
+	{
+		static constexpr std::size_t huge_page_size = std::size_t{ 1 } << 21;
+		static constexpr std::size_t default_block_size = huge_page_size;
+		static constexpr std::size_t max_block_size = std::size_t{ 1 } << 30;
+
+		static void* allocate(std::size_t& size)
+		{
+			size = (size + huge_page_size - 1) & ~(huge_page_size - 1);
+
+			void* mapping = ::mmap(nullptr, size + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+			if (mapping == MAP_FAILED)
+			{
+				throw std::bad_alloc{};
+			}
+
+			const std::uintptr_t raw = reinterpret_cast<std::uintptr_t>(mapping);
+			const std::uintptr_t aligned = (raw + huge_page_size - 1) & ~(huge_page_size - 1);
+
+			if (aligned != raw)
+			{
+				::munmap(mapping, aligned - raw);
+			}
+
+			if (const std::size_t tail = raw + huge_page_size - aligned; tail != 0)
+			{
+				::munmap(reinterpret_cast<void*>(aligned + size), tail);
+			}
+
+			void* block = reinterpret_cast<void*>(aligned);
+
+			if (::madvise(block, size, HugePages ? MADV_HUGEPAGE : MADV_NOHUGEPAGE) != 0 && errno != EINVAL)
+			{
+				const int error = errno;
+				::munmap(block, size);
+				throw std::system_error(error, std::generic_category(), "madvise");
+			}
+
+			return block;
+		}
+
+		static void deallocate(void* block, std::size_t size) noexcept
+		{
+			::munmap(block, size);
+		}
+	};
+
+	using huge_page_arena = basic_arena<mmap_block_source<true>>;
+	using small_page_arena = basic_arena<mmap_block_source<false>>;
+
+	template <typename T>
+	using huge_page_allocator = arena_allocator<T, huge_page_arena>;
+
+	template <typename T>
+	using small_page_allocator = arena_allocator<T, small_page_arena>;
+}
+
+#endif // CONSTEXPR_LIST_HUGE_PAGE_ARENA
@@ -0,0 +1,279 @@
+#ifndef CONSTEXPR_LIST_LRU_CACHE
+#define CONSTEXPR_LIST_LRU_CACHE
+
+#include <bit>
+#include <vector>
+
+#include "constexpr_list.hpp"
+
+namespace constexpr_list
+{
+	namespace detail
+	{
+		struct no_eviction_callback
+		{
+			template <typename K, typename V>
+			constexpr void operator()(K&&, V&&) const noexcept {}
+		};
+	}
+
+	template <
+		typename Key,
+		typename Value,
+		typename Hash = std::hash<Key>,
+		typename KeyEqual = std::equal_to<Key>,
+		typename OnEvict = detail::no_eviction_callback,
+		typename Allocator = std::allocator<std::pair<const Key, Value>>
+	>
+	class lru_cache
+	{
+		struct entry_
+		{
+			Key key_;
+			Value value_;
+			std::size_t hash_;
+		};
+
+		using entry_allocator = typename
+			std::allocator_traits<Allocator>::template rebind_alloc<entry_>;
+		using entry_list = list<entry_, entry_allocator>;
+		using entry_iterator = typename entry_list::iterator;
+		using slot_allocator = typename
+			std::allocator_traits<Allocator>::template rebind_alloc<entry_iterator>;
+
+	public:
+		using key_type = Key;
+		using mapped_type = Value;
+		using hasher = Hash;
+		using key_equal = KeyEqual;
+		using allocator_type = Allocator;
+		using size_type = std::size_t;
+
+		explicit constexpr lru_cache(size_type capacity,
+			const Hash& hash = Hash(),
+			const KeyEqual& equal = KeyEqual(),
+			const OnEvict& on_evict = OnEvict(),
+			const Allocator& alloc = Allocator())
+			: entries_(entry_allocator(alloc))
+			, slots_(std::bit_ceil(std::max<size_type>(capacity * 2, 2)), entry_iterator{}, slot_allocator(alloc))
+			, capacity_{ std::max<size_type>(capacity, 1) }
+			, hash_(hash)
+			, equal_(equal)
+			, on_evict_(on_evict)
+		{}
+
+		constexpr lru_cache(const lru_cache& other)
+			: entries_(other.entries_)
+			, slots_(other.slots_.size(), entry_iterator{},
+				std::allocator_traits<slot_allocator>::select_on_container_copy_construction(other.slots_.get_allocator()))
+			, capacity_{ other.capacity_ }
+			, hash_(other.hash_)
+			, equal_(other.equal_)
+			, on_evict_(other.on_evict_)
+		{
+			for (entry_iterator it = entries_.begin(); it != entries_.end(); ++it)
+			{
+				slots_[this->find_slot_(it->key_, it->hash_)] = it;
+			}
+		}
+
+		constexpr lru_cache(lru_cache&& other) = default;
+
+		constexpr lru_cache& operator=(const lru_cache& other)
+		{
+			if (this != &other)
+			{
+				lru_cache copy(other);
+				this->swap(copy);
+			}
+
+			return *this;
+		}
+
+		constexpr lru_cache& operator=(lru_cache&& other) = default;
+
+		constexpr Value* get(const Key& key)
+		{
+			const size_type slot = this->find_slot_(key, hash_(key));
+
+			if (slots_[slot] == entry_iterator{})
+			{
+				return nullptr;
+			}
+
+			entries_.splice(entries_.begin(), entries_, slots_[slot]);
+			return std::addressof(slots_[slot]->value_);
+		}
+
+		constexpr const Value* peek(const Key& key) const
+		{
+			const size_type slot = this->find_slot_(key, hash_(key));
+
+			if (slots_[slot] == entry_iterator{})
+			{
+				return nullptr;
+			}
+
+			return std::addressof(slots_[slot]->value_);
+		}
+
+		constexpr bool contains(const Key& key) const
+		{
+			return this->peek(key) != nullptr;
+		}
+
+		constexpr Value& put(Key key, Value value)
+		{
+			const std::size_t hash = hash_(key);
+			size_type slot = this->find_slot_(key, hash);
+
+			if (slots_[slot] != entry_iterator{})
+			{
+				slots_[slot]->value_ = std::move(value);
+				entries_.splice(entries_.begin(), entries_, slots_[slot]);
+				return slots_[slot]->value_;
+			}
+
+			if (entries_.size() == capacity_)
+			{
+				entry_iterator victim = std::ranges::prev(entries_.end());
+				const size_type victim_slot = this->find_slot_(victim->key_, victim->hash_);
+
+				try
+				{
+					std::invoke(on_evict_, std::move(victim->key_), std::move(victim->value_));
+				}
+				catch (...)
+				{
+					this->erase_slot_(victim_slot);
+					entries_.erase(victim);
+					throw;
+				}
+
+				this->erase_slot_(victim_slot);
+
+				victim->key_ = std::move(key);
+				victim->value_ = std::move(value);
+				victim->hash_ = hash;
+				entries_.splice(entries_.begin(), entries_, victim);
+
+				slot = this->find_slot_(victim->key_, hash);
+			}
+			else
+			{
+				entries_.emplace_front(std::move(key), std::move(value), hash);
+			}
+
+			slots_[slot] = entries_.begin();
+			return entries_.front().value_;
+		}
+
+		constexpr bool erase(const Key& key)
+		{
+			const size_type slot = this->find_slot_(key, hash_(key));
+
+			if (slots_[slot] == entry_iterator{})
+			{
+				return false;
+			}
+
+			entries_.erase(slots_[slot]);
+			this->erase_slot_(slot);
+			return true;
+		}
+
+		constexpr void clear()
+		{
+			entries_.clear();
+			std::ranges::fill(slots_, entry_iterator{});
+		}
+
+		[[nodiscard]]
+		constexpr size_type size() const noexcept
+		{
+			return entries_.size();
+		}
+
+		[[nodiscard]]
+		constexpr size_type capacity() const noexcept
+		{
+			return capacity_;
+		}
+
+		[[nodiscard]]
+		constexpr bool empty() const noexcept
+		{
+			return entries_.empty();
+		}
+
+		constexpr allocator_type get_allocator() const noexcept
+		{
+			return static_cast<allocator_type>(entries_.get_allocator());
+		}
+
+		constexpr void swap(lru_cache& other) noexcept
+		{
+			entries_.swap(other.entries_);
+			slots_.swap(other.slots_);
+			std::ranges::swap(capacity_, other.capacity_);
+			std::ranges::swap(hash_, other.hash_);
+			std::ranges::swap(equal_, other.equal_);
+			std::ranges::swap(on_evict_, other.on_evict_);
+		}
+
+		friend constexpr void swap(lru_cache& lhs, lru_cache& rhs) noexcept
+		{
+			lhs.swap(rhs);
+		}
+
+	private:
+		constexpr size_type find_slot_(const Key& key, std::size_t hash) const
+		{
+			const size_type mask = slots_.size() - 1;
+			size_type slot = hash & mask;
+
+			while (slots_[slot] != entry_iterator{})
+			{
+				if (slots_[slot]->hash_ == hash && equal_(slots_[slot]->key_, key))
+				{
+					return slot;
+				}
+
+				slot = (slot + 1) & mask;
+			}
+
+			return slot;
+		}
+
+		constexpr void erase_slot_(size_type hole) noexcept
+		{
+			const size_type mask = slots_.size() - 1;
+			size_type slot = (hole + 1) & mask;
+
+			while (slots_[slot] != entry_iterator{})
+			{
+				const size_type home = slots_[slot]->hash_ & mask;
+
+				if (((slot - home) & mask) >= ((slot - hole) & mask))
+				{
+					slots_[hole] = slots_[slot];
+					hole = slot;
+				}
+
+				slot = (slot + 1) & mask;
+			}
+
+			slots_[hole] = entry_iterator{};
+		}
+
+		entry_list entries_;
+		std::vector<entry_iterator, slot_allocator> slots_;
+		size_type capacity_;
+
+		[[no_unique_address]] Hash hash_;
+		[[no_unique_address]] KeyEqual equal_;
+		[[no_unique_address]] OnEvict on_evict_;
+	};
+}
+
+#endif // CONSTEXPR_LIST_LRU_CACHE
@@ -0,0 +1,376 @@
+#ifndef CONSTEXPR_LIST_MAPPED_ARENA
+#define CONSTEXPR_LIST_MAPPED_ARENA
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "offset_ptr.hpp"
+
+namespace constexpr_list
+{
+	namespace detail
+	{
+		struct mapped_free_bin
+		{
+			std::size_t bytes_;
+			std::size_t head_;
+		};
+
+		struct mapped_arena_header
+		{
+			static constexpr std::uint64_t magic = 0x434C'4953'5441'5246ull;
+			static constexpr std::size_t bin_count = 8;
+
+			std::uint64_t magic_;
+			std::size_t capacity_;
+			std::size_t used_;
+			offset_ptr<void> root_;
+			std::uint32_t bins_lock_ = 0;
+			mapped_free_bin bins_[bin_count] = {};
+
+			void* allocate(std::size_t bytes, std::size_t alignment)
+			{
+				const auto base = reinterpret_cast<std::uintptr_t>(this);
+
+				if (void* reused = this->pop_free_(bytes, alignment))
+				{
+					return reused;
+				}
+
+				std::atomic_ref<std::size_t> used{ used_ };
+				std::size_t current = used.load(std::memory_order_relaxed);
+				std::size_t offset;
+
+				do
+				{
+					offset = ((base + current + alignment - 1) & ~(alignment - 1)) - base;
+
+					if (offset + bytes < offset || offset + bytes > capacity_)
+					{
+						throw std::bad_alloc{};
+					}
+				}
+				while (!used.compare_exchange_weak(current, offset + bytes, std::memory_order_relaxed));
+
+				return reinterpret_cast<unsigned char*>(this) + offset;
+			}
+
+			void deallocate(void* ptr, std::size_t bytes) noexcept
+			{
+				const std::size_t offset = static_cast<std::size_t>(
+					static_cast<unsigned char*>(ptr) - reinterpret_cast<unsigned char*>(this));
+				std::size_t expected = offset + bytes;
+
+				if (!std::atomic_ref<std::size_t>{ used_ }.compare_exchange_strong(expected, offset, std::memory_order_relaxed))
+				{
+					this->push_free_(offset, bytes);
+				}
+			}
+
+		private:
+			void lock_bins_() noexcept
+			{
+				std::atomic_ref<std::uint32_t> lock{ bins_lock_ };
+
+				while (lock.exchange(1, std::memory_order_acquire) != 0)
+				{
+					lock.wait(1, std::memory_order_relaxed);
+				}
+			}
+
+			void unlock_bins_() noexcept
+			{
+				std::atomic_ref<std::uint32_t> lock{ bins_lock_ };
+				lock.store(0, std::memory_order_release);
+				lock.notify_one();
+			}
+
+			std::size_t* link_at_(std::size_t offset) noexcept
+			{
+				return std::launder(reinterpret_cast<std::size_t*>(reinterpret_cast<unsigned char*>(this) + offset));
+			}
+
+			void* pop_free_(std::size_t bytes, std::size_t alignment) noexcept
+			{
+				void* result = nullptr;
+				this->lock_bins_();
+
+				for (mapped_free_bin& bin : bins_)
+				{
+					if (bin.bytes_ == bytes)
+					{
+						if (bin.head_ != 0 && (reinterpret_cast<std::uintptr_t>(this) + bin.head_) % alignment == 0)
+						{
+							result = reinterpret_cast<unsigned char*>(this) + bin.head_;
+							bin.head_ = *this->link_at_(bin.head_);
+						}
+
+						break;
+					}
+				}
+
+				this->unlock_bins_();
+				return result;
+			}
+
+			void push_free_(std::size_t offset, std::size_t bytes) noexcept
+			{
+				if (bytes < sizeof(std::size_t) || offset % alignof(std::size_t) != 0)
+				{
+					return;
+				}
+
+				this->lock_bins_();
+
+				for (mapped_free_bin& bin : bins_)
+				{
+					if (bin.bytes_ == bytes || bin.bytes_ == 0)
+					{
+						bin.bytes_ = bytes;
+						::new (reinterpret_cast<unsigned char*>(this) + offset) std::size_t(bin.head_);
+						bin.head_ = offset;
+						break;
+					}
+				}
+
+				this->unlock_bins_();
+			}
+		};
+	}
+
+	// Blocks freed out of order are kept on per-size free lists in the header and reused by later
+	// allocations of the same size, which covers the fixed-size nodes of a list. Only the first
+	// bin_count distinct sizes get a free list; blocks of any other size are reclaimed only when
+	// they are the most recent allocation, and are otherwise lost until the file is recreated.
+	class mapped_file_arena
+	{
+	public:
+		mapped_file_arena(const char* path, std::size_t capacity)
+		{
+			fd_ = ::open(path, O_RDWR | O_CREAT, 0644);
+
+			if (fd_ == -1)
+			{
+				throw std::system_error(errno, std::generic_category(), "open");
+			}
+
+			struct stat info{};
+
+			if (::fstat(fd_, &info) == -1)
+			{
+				this->fail_("fstat");
+			}
+
+			const bool fresh = info.st_size == 0;
+
+			if (fresh)
+			{
+				if (capacity < sizeof(detail::mapped_arena_header))
+				{
+					capacity = sizeof(detail::mapped_arena_header);
+				}
+
+				if (::ftruncate(fd_, static_cast<off_t>(capacity)) == -1)
+				{
+					this->fail_("ftruncate");
+				}
+			}
+			else
+			{
+				capacity = static_cast<std::size_t>(info.st_size);
+			}
+
+			void* mapping = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+
+			if (mapping == MAP_FAILED)
+			{
+				this->fail_("mmap");
+			}
+
+			header_ = static_cast<detail::mapped_arena_header*>(mapping);
+			size_ = capacity;
+
+			if (fresh)
+			{
+				std::construct_at(header_, detail::mapped_arena_header{
+					detail::mapped_arena_header::magic,
+					capacity,
+					sizeof(detail::mapped_arena_header),
+					nullptr
+				});
+			}
+			else if (header_->magic_ != detail::mapped_arena_header::magic || header_->capacity_ != capacity)
+			{
+				this->release_();
+				throw std::system_error(std::make_error_code(std::errc::invalid_argument), "mapped_file_arena");
+			}
+		}
+
+		mapped_file_arena(const mapped_file_arena&) = delete;
+		mapped_file_arena& operator=(const mapped_file_arena&) = delete;
+
+		mapped_file_arena(mapped_file_arena&& other) noexcept
+			: header_{ std::exchange(other.header_, nullptr) }
+			, size_{ std::exchange(other.size_, 0) }
+			, fd_{ std::exchange(other.fd_, -1) }
+		{}
+
+		mapped_file_arena& operator=(mapped_file_arena&& other) noexcept
+		{
+			if (this != &other)
+			{
+				this->release_();
+				header_ = std::exchange(other.header_, nullptr);
+				size_ = std::exchange(other.size_, 0);
+				fd_ = std::exchange(other.fd_, -1);
+			}
+
+			return *this;
+		}
+
+		~mapped_file_arena()
+		{
+			this->release_();
+		}
+
+		template <typename T, typename ... Args>
+		T& find_or_construct_root(Args&& ... args)
+		{
+			if (!header_->root_)
+			{
+				T* root = static_cast<T*>(header_->allocate(sizeof(T), alignof(T)));
+				std::construct_at(root, std::forward<Args>(args)...);
+				header_->root_ = root;
+			}
+
+			return *static_cast<T*>(header_->root_.get());
+		}
+
+		template <typename T>
+		T* find_root() const noexcept
+		{
+			return static_cast<T*>(header_->root_.get());
+		}
+
+		template <typename T>
+		void destroy_root()
+		{
+			if (header_->root_)
+			{
+				std::destroy_at(static_cast<T*>(header_->root_.get()));
+				header_->root_ = nullptr;
+			}
+		}
+
+		void sync() const
+		{
+			if (::msync(header_, size_, MS_SYNC) == -1)
+			{
+				throw std::system_error(errno, std::generic_category(), "msync");
+			}
+		}
+
+		std::size_t capacity() const noexcept
+		{
+			return header_->capacity_;
+		}
+
+		std::size_t used() const noexcept
+		{
+			return std::atomic_ref<std::size_t>{ header_->used_ }.load(std::memory_order_relaxed);
+		}
+
+		detail::mapped_arena_header* header() const noexcept
+		{
+			return header_;
+		}
+
+	private:
+		[[noreturn]] void fail_(const char* what)
+		{
+			const int error = errno;
+			this->release_();
+			throw std::system_error(error, std::generic_category(), what);
+		}
+
+		void release_() noexcept
+		{
+			if (header_ != nullptr)
+			{
+				::munmap(header_, size_);
+				header_ = nullptr;
+			}
+
+			if (fd_ != -1)
+			{
+				::close(fd_);
+				fd_ = -1;
+			}
+		}
+
+		detail::mapped_arena_header* header_ = nullptr;
+		std::size_t size_ = 0;
+		int fd_ = -1;
+	};
+
+	template <typename T>
+	class mapped_allocator
+	{
+		template <typename U>
+		friend class mapped_allocator;
+
+	public:
+		using value_type = T;
+		using pointer = offset_ptr<T>;
+		using const_pointer = offset_ptr<const T>;
+		using void_pointer = offset_ptr<void>;
+		using const_void_pointer = offset_ptr<const void>;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using is_always_equal = std::false_type;
+
+		explicit mapped_allocator(const mapped_file_arena& arena) noexcept
+			: header_{ arena.header() }
+		{}
+
+		template <typename U>
+		mapped_allocator(const mapped_allocator<U>& other) noexcept
+			: header_{ other.header_ }
+		{}
+
+		pointer allocate(size_type n)
+		{
+			if (n > std::numeric_limits<size_type>::max() / sizeof(T))
+			{
+				throw std::bad_array_new_length{};
+			}
+
+			return pointer{ static_cast<T*>(header_->allocate(n * sizeof(T), alignof(T))) };
+		}
+
+		void deallocate(pointer ptr, size_type n) noexcept
+		{
+			header_->deallocate(ptr.get(), n * sizeof(T));
+		}
+
+		friend bool operator==(const mapped_allocator& lhs, const mapped_allocator& rhs) noexcept
+		{
+			return lhs.header_ == rhs.header_;
+		}
+
+	private:
+		offset_ptr<detail::mapped_arena_header> header_;
+	};
+}
+
+#endif // CONSTEXPR_LIST_MAPPED_ARENA
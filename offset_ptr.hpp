@@ -0,0 +1,200 @@
+#ifndef CONSTEXPR_LIST_OFFSET_PTR
+#define CONSTEXPR_LIST_OFFSET_PTR
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace constexpr_list
+{
+	template <typename T>
+	class offset_ptr
+	{
+		template <typename U>
+		friend class offset_ptr;
+
+	public:
+		using element_type = T;
+		using value_type = std::remove_cv_t<T>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = T*;
+		using reference = std::add_lvalue_reference_t<T>;
+		using iterator_category = std::random_access_iterator_tag;
+		using iterator_concept = std::contiguous_iterator_tag;
+
+		template <typename U>
+		using rebind = offset_ptr<U>;
+
+		offset_ptr() noexcept = default;
+
+		offset_ptr(std::nullptr_t) noexcept
+		{}
+
+		offset_ptr(T* ptr) noexcept
+		{
+			this->set_(ptr);
+		}
+
+		offset_ptr(const offset_ptr& other) noexcept
+		{
+			this->set_(other.get());
+		}
+
+		template <typename U> requires std::is_convertible_v<U*, T*>
+		offset_ptr(const offset_ptr<U>& other) noexcept
+		{
+			this->set_(static_cast<T*>(other.get()));
+		}
+
+		template <typename U>
+			requires (!std::is_convertible_v<U*, T*>) && requires (U* ptr) { static_cast<T*>(ptr); }
+		explicit offset_ptr(const offset_ptr<U>& other) noexcept
+		{
+			this->set_(static_cast<T*>(other.get()));
+		}
+
+		offset_ptr& operator=(const offset_ptr& other) noexcept
+		{
+			this->set_(other.get());
+			return *this;
+		}
+
+		offset_ptr& operator=(T* ptr) noexcept
+		{
+			this->set_(ptr);
+			return *this;
+		}
+
+		offset_ptr& operator=(std::nullptr_t) noexcept
+		{
+			offset_ = null_offset_;
+			return *this;
+		}
+
+		template <typename U> requires std::same_as<U, T> && (!std::is_void_v<U>)
+		static offset_ptr pointer_to(U& ref) noexcept
+		{
+			return offset_ptr{ std::addressof(ref) };
+		}
+
+		T* get() const noexcept
+		{
+			if (offset_ == null_offset_)
+			{
+				return nullptr;
+			}
+
+			return reinterpret_cast<T*>(reinterpret_cast<std::uintptr_t>(this) + offset_);
+		}
+
+		T* operator->() const noexcept
+		{
+			return this->get();
+		}
+
+		template <typename U = T> requires (!std::is_void_v<U>)
+		U& operator*() const noexcept
+		{
+			return *this->get();
+		}
+
+		template <typename U = T> requires (!std::is_void_v<U>)
+		U& operator[](difference_type n) const noexcept
+		{
+			return this->get()[n];
+		}
+
+		explicit operator bool() const noexcept
+		{
+			return offset_ != null_offset_;
+		}
+
+		offset_ptr& operator++() noexcept
+		{
+			return *this += 1;
+		}
+
+		offset_ptr operator++(int) noexcept
+		{
+			auto tmp = *this;
+			++(*this);
+			return tmp;
+		}
+
+		offset_ptr& operator--() noexcept
+		{
+			return *this -= 1;
+		}
+
+		offset_ptr operator--(int) noexcept
+		{
+			auto tmp = *this;
+			--(*this);
+			return tmp;
+		}
+
+		offset_ptr& operator+=(difference_type n) noexcept
+		{
+			this->set_(this->get() + n);
+			return *this;
+		}
+
+		offset_ptr& operator-=(difference_type n) noexcept
+		{
+			this->set_(this->get() - n);
+			return *this;
+		}
+
+		friend offset_ptr operator+(offset_ptr ptr, difference_type n) noexcept
+		{
+			return ptr += n;
+		}
+
+		friend offset_ptr operator+(difference_type n, offset_ptr ptr) noexcept
+		{
+			return ptr += n;
+		}
+
+		friend offset_ptr operator-(offset_ptr ptr, difference_type n) noexcept
+		{
+			return ptr -= n;
+		}
+
+		friend difference_type operator-(const offset_ptr& lhs, const offset_ptr& rhs) noexcept
+		{
+			return lhs.get() - rhs.get();
+		}
+
+		friend bool operator==(const offset_ptr& lhs, const offset_ptr& rhs) noexcept
+		{
+			return lhs.get() == rhs.get();
+		}
+
+		friend bool operator==(const offset_ptr& lhs, std::nullptr_t) noexcept
+		{
+			return !lhs;
+		}
+
+		friend std::strong_ordering operator<=>(const offset_ptr& lhs, const offset_ptr& rhs) noexcept
+		{
+			return std::compare_three_way{}(lhs.get(), rhs.get());
+		}
+
+	private:
+		static constexpr std::uintptr_t null_offset_ = 1;
+
+		void set_(const volatile void* ptr) noexcept
+		{
+			offset_ = ptr == nullptr
+				? null_offset_
+				: reinterpret_cast<std::uintptr_t>(ptr) - reinterpret_cast<std::uintptr_t>(this);
+		}
+
+		std::uintptr_t offset_ = null_offset_;
+	};
+}
+
+#endif // CONSTEXPR_LIST_OFFSET_PTR
@@ -0,0 +1,498 @@
+#ifndef CONSTEXPR_LIST_PERSISTENT_LIST
+#define CONSTEXPR_LIST_PERSISTENT_LIST
+
+#include <atomic>
+
+#include "constexpr_list.hpp"
+
+namespace constexpr_list
+{
+	template <typename T, typename Allocator = std::allocator<T>>
+	class persistent_list
+	{
+		struct node_
+		{
+			template <typename ... Args>
+			constexpr explicit node_(node_* next, Args&& ... args)
+				: value_(std::forward<Args>(args)...)
+				, next_{ next }
+			{}
+
+			T value_;
+			node_* next_;
+			std::size_t refs_ = 1;
+		};
+
+		using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node_>;
+		using traits = std::allocator_traits<node_allocator>;
+
+		static_assert(std::is_pointer_v<typename traits::pointer>,
+			"persistent_list links nodes through raw pointers and cannot store fancy allocator pointers");
+
+	public:
+		using value_type = T;
+		using allocator_type = Allocator;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = const T&;
+		using const_reference = const T&;
+
+		class const_iterator
+		{
+			friend class persistent_list;
+
+		public:
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using reference = const T&;
+			using pointer = const T*;
+			using iterator_category = std::forward_iterator_tag;
+
+			constexpr const_iterator() noexcept = default;
+
+			constexpr reference operator*() const noexcept
+			{
+				return current_->value_;
+			}
+
+			constexpr pointer operator->() const noexcept
+			{
+				return std::addressof(current_->value_);
+			}
+
+			constexpr const_iterator& operator++() noexcept
+			{
+				current_ = current_->next_;
+				return *this;
+			}
+
+			constexpr const_iterator operator++(int) noexcept
+			{
+				auto tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			friend constexpr bool operator==(const const_iterator&, const const_iterator&) noexcept = default;
+
+		private:
+			constexpr explicit const_iterator(const node_* node) noexcept
+				: current_{ node }
+			{}
+
+			const node_* current_ = nullptr;
+		};
+
+		using iterator = const_iterator;
+
+		class builder
+		{
+			friend class persistent_list;
+
+		public:
+			constexpr builder() noexcept = default;
+
+			explicit constexpr builder(const Allocator& alloc) noexcept
+				: alloc_(alloc)
+			{}
+
+			builder(const builder&) = delete;
+			builder& operator=(const builder&) = delete;
+
+			constexpr builder(builder&& other) noexcept
+				: head_{ std::exchange(other.head_, nullptr) }
+				, shared_{ std::exchange(other.shared_, nullptr) }
+				, owned_tail_{ std::exchange(other.owned_tail_, nullptr) }
+				, size_{ std::exchange(other.size_, 0) }
+				, alloc_(other.alloc_)
+			{}
+
+			constexpr ~builder()
+			{
+				persistent_list::release_(alloc_, head_);
+			}
+
+			template <typename ... Args>
+			constexpr const T& emplace_front(Args&& ... args)
+			{
+				head_ = persistent_list::make_node_(alloc_, head_, std::forward<Args>(args)...);
+
+				if (!owned_tail_)
+				{
+					owned_tail_ = head_;
+				}
+
+				++size_;
+				return head_->value_;
+			}
+
+			constexpr void push_front(const T& value)
+			{
+				this->emplace_front(value);
+			}
+
+			constexpr void push_front(T&& value)
+			{
+				this->emplace_front(std::move(value));
+			}
+
+			template <typename ... Args>
+			constexpr const T& emplace_back(Args&& ... args)
+			{
+				if (shared_)
+				{
+					this->unshare_();
+				}
+
+				node_* node = persistent_list::make_node_(alloc_, nullptr, std::forward<Args>(args)...);
+				(owned_tail_ ? owned_tail_->next_ : head_) = node;
+				owned_tail_ = node;
+				++size_;
+				return node->value_;
+			}
+
+			constexpr void push_back(const T& value)
+			{
+				this->emplace_back(value);
+			}
+
+			constexpr void push_back(T&& value)
+			{
+				this->emplace_back(std::move(value));
+			}
+
+			constexpr void pop_front() noexcept
+			{
+				node_* old = head_;
+				head_ = old->next_;
+
+				if (old == shared_)
+				{
+					persistent_list::retain_(head_);
+					shared_ = head_;
+				}
+				else
+				{
+					if (owned_tail_ == old)
+					{
+						owned_tail_ = nullptr;
+					}
+
+					old->next_ = nullptr;
+				}
+
+				persistent_list::release_(alloc_, old);
+				--size_;
+			}
+
+			[[nodiscard]]
+			constexpr const T& front() const noexcept
+			{
+				return head_->value_;
+			}
+
+			[[nodiscard]]
+			constexpr size_type size() const noexcept
+			{
+				return size_;
+			}
+
+			[[nodiscard]]
+			constexpr bool empty() const noexcept
+			{
+				return size_ == 0;
+			}
+
+			[[nodiscard]]
+			constexpr persistent_list persistent() && noexcept
+			{
+				shared_ = nullptr;
+				owned_tail_ = nullptr;
+				return persistent_list(std::exchange(head_, nullptr), std::exchange(size_, 0), alloc_);
+			}
+
+		private:
+			constexpr builder(node_* shared, size_type size, const node_allocator& alloc) noexcept
+				: head_{ shared }
+				, shared_{ shared }
+				, size_{ size }
+				, alloc_(alloc)
+			{}
+
+			constexpr void unshare_()
+			{
+				node_* first = nullptr;
+				node_* last = nullptr;
+
+				try
+				{
+					for (const node_* node = shared_; node; node = node->next_)
+					{
+						node_* copy = persistent_list::make_node_(alloc_, nullptr, node->value_);
+						(last ? last->next_ : first) = copy;
+						last = copy;
+					}
+				}
+				catch (...)
+				{
+					persistent_list::release_(alloc_, first);
+					throw;
+				}
+
+				(owned_tail_ ? owned_tail_->next_ : head_) = first;
+				persistent_list::release_(alloc_, shared_);
+				shared_ = nullptr;
+				owned_tail_ = last;
+			}
+
+			node_* head_ = nullptr;
+			node_* shared_ = nullptr;
+			node_* owned_tail_ = nullptr;
+			size_type size_ = 0;
+			[[no_unique_address]] node_allocator alloc_;
+		};
+
+		constexpr persistent_list() noexcept = default;
+
+		explicit constexpr persistent_list(const Allocator& alloc) noexcept
+			: alloc_(alloc)
+		{}
+
+		constexpr persistent_list(std::initializer_list<T> il, const Allocator& alloc = Allocator())
+			: persistent_list(std::from_range, il, alloc)
+		{}
+
+		template <detail::container_compatible_range<T> R>
+		constexpr persistent_list(std::from_range_t, R&& rg, const Allocator& alloc = Allocator())
+			: alloc_(alloc)
+		{
+			builder b(alloc);
+
+			for (auto&& value : rg)
+			{
+				b.emplace_back(std::forward<decltype(value)>(value));
+			}
+
+			*this = std::move(b).persistent();
+		}
+
+		template <typename ... Policies>
+		explicit constexpr persistent_list(const list<T, Allocator, Policies...>& source)
+			: persistent_list(std::from_range, source, source.get_allocator())
+		{}
+
+		constexpr persistent_list(const persistent_list& other) noexcept
+			: head_{ other.head_ }
+			, size_{ other.size_ }
+			, alloc_(other.alloc_)
+		{
+			retain_(head_);
+		}
+
+		constexpr persistent_list(persistent_list&& other) noexcept
+			: head_{ std::exchange(other.head_, nullptr) }
+			, size_{ std::exchange(other.size_, 0) }
+			, alloc_(other.alloc_)
+		{}
+
+		constexpr persistent_list& operator=(const persistent_list& other) noexcept
+		{
+			retain_(other.head_);
+			release_(alloc_, head_);
+			head_ = other.head_;
+			size_ = other.size_;
+			alloc_ = other.alloc_;
+			return *this;
+		}
+
+		constexpr persistent_list& operator=(persistent_list&& other) noexcept
+		{
+			if (this != &other)
+			{
+				release_(alloc_, head_);
+				head_ = std::exchange(other.head_, nullptr);
+				size_ = std::exchange(other.size_, 0);
+				alloc_ = other.alloc_;
+			}
+
+			return *this;
+		}
+
+		constexpr ~persistent_list()
+		{
+			release_(alloc_, head_);
+		}
+
+		template <typename ... Args>
+		[[nodiscard]]
+		constexpr persistent_list emplace_front(Args&& ... args) const
+		{
+			node_allocator alloc = alloc_;
+			node_* node = make_node_(alloc, head_, std::forward<Args>(args)...);
+			retain_(head_);
+			return persistent_list(node, size_ + 1, alloc);
+		}
+
+		[[nodiscard]]
+		constexpr persistent_list push_front(const T& value) const
+		{
+			return this->emplace_front(value);
+		}
+
+		[[nodiscard]]
+		constexpr persistent_list push_front(T&& value) const
+		{
+			return this->emplace_front(std::move(value));
+		}
+
+		[[nodiscard]]
+		constexpr persistent_list pop_front() const noexcept
+		{
+			retain_(head_->next_);
+			return persistent_list(head_->next_, size_ - 1, alloc_);
+		}
+
+		[[nodiscard]]
+		constexpr builder transient() const noexcept
+		{
+			retain_(head_);
+			return builder(head_, size_, alloc_);
+		}
+
+		template <typename ... Policies>
+		[[nodiscard]]
+		constexpr list<T, Allocator, Policies...> to_list() const
+		{
+			return list<T, Allocator, Policies...>(this->begin(), this->end(), this->get_allocator());
+		}
+
+		[[nodiscard]]
+		constexpr const T& front() const noexcept
+		{
+			return head_->value_;
+		}
+
+		[[nodiscard]]
+		constexpr size_type size() const noexcept
+		{
+			return size_;
+		}
+
+		[[nodiscard]]
+		constexpr bool empty() const noexcept
+		{
+			return size_ == 0;
+		}
+
+		[[nodiscard]]
+		constexpr size_type use_count() const noexcept
+		{
+			return head_ ? head_->refs_ : 0;
+		}
+
+		constexpr const_iterator begin() const noexcept
+		{
+			return const_iterator{ head_ };
+		}
+
+		constexpr const_iterator end() const noexcept
+		{
+			return const_iterator{};
+		}
+
+		constexpr const_iterator cbegin() const noexcept
+		{
+			return this->begin();
+		}
+
+		constexpr const_iterator cend() const noexcept
+		{
+			return this->end();
+		}
+
+		constexpr allocator_type get_allocator() const noexcept
+		{
+			return static_cast<allocator_type>(alloc_);
+		}
+
+		friend constexpr bool operator==(const persistent_list& lhs, const persistent_list& rhs)
+		{
+			return lhs.size_ == rhs.size_ && (lhs.head_ == rhs.head_ || std::ranges::equal(lhs, rhs));
+		}
+
+	private:
+		constexpr persistent_list(node_* head, size_type size, const node_allocator& alloc) noexcept
+			: head_{ head }
+			, size_{ size }
+			, alloc_(alloc)
+		{}
+
+		template <typename ... Args>
+		static constexpr node_* make_node_(node_allocator& alloc, node_* next, Args&& ... args)
+		{
+			node_* node = traits::allocate(alloc, 1);
+
+			try
+			{
+				traits::construct(alloc, node, next, std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				traits::deallocate(alloc, node, 1);
+				throw;
+			}
+
+			return node;
+		}
+
+		static constexpr void retain_(node_* node) noexcept
+		{
+			if (!node)
+			{
+				return;
+			}
+
+			if consteval
+			{
+				++node->refs_;
+			}
+			else
+			{
+				std::atomic_ref<std::size_t>{ node->refs_ }.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		static constexpr void release_(node_allocator& alloc, node_* node) noexcept
+		{
+			while (node)
+			{
+				std::size_t remaining;
+
+				if consteval
+				{
+					remaining = --node->refs_;
+				}
+				else
+				{
+					remaining = std::atomic_ref<std::size_t>{ node->refs_ }.fetch_sub(1, std::memory_order_acq_rel) - 1;
+				}
+
+				if (remaining != 0)
+				{
+					return;
+				}
+
+				node_* next = node->next_;
+				traits::destroy(alloc, node);
+				traits::deallocate(alloc, node, 1);
+				node = next;
+			}
+		}
+
+		node_* head_ = nullptr;
+		size_type size_ = 0;
+		[[no_unique_address]] node_allocator alloc_;
+	};
+}
+
+#endif // CONSTEXPR_LIST_PERSISTENT_LIST
@@ -0,0 +1,563 @@
+#ifndef CONSTEXPR_LIST_RCU_LIST
+#define CONSTEXPR_LIST_RCU_LIST
+
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "constexpr_list.hpp"
+
+namespace constexpr_list::concurrent
+{
+	template <typename T, typename Allocator = std::allocator<T>>
+	class rcu_list
+	{
+		struct node_
+		{
+			template <typename ... Args>
+			explicit node_(Args&& ... args)
+				: value_(std::forward<Args>(args)...)
+			{}
+
+			T value_;
+			std::atomic<node_*> next_ = nullptr;
+		};
+
+		struct slot_
+		{
+			std::thread::id thread_;
+			slot_* next_ = nullptr;
+			std::atomic<std::uint64_t> epoch_ = 0;
+			std::size_t depth_ = 0;
+		};
+
+		struct retired_
+		{
+			node_* target_;
+			std::uint64_t epoch_;
+		};
+
+		struct memo_
+		{
+			std::uint64_t list_ = 0;
+			slot_* entry_ = nullptr;
+		};
+
+		using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node_>;
+		using traits = std::allocator_traits<node_allocator>;
+
+		static_assert(std::is_pointer_v<typename traits::pointer>,
+			"rcu_list links nodes through raw pointers and cannot store fancy allocator pointers");
+
+	public:
+		using value_type = T;
+		using allocator_type = Allocator;
+		using size_type = std::size_t;
+
+		class const_iterator
+		{
+			friend class rcu_list;
+
+		public:
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using reference = const T&;
+			using pointer = const T*;
+			using iterator_category = std::forward_iterator_tag;
+
+			const_iterator() noexcept = default;
+
+			reference operator*() const noexcept
+			{
+				return current_->value_;
+			}
+
+			pointer operator->() const noexcept
+			{
+				return std::addressof(current_->value_);
+			}
+
+			const_iterator& operator++() noexcept
+			{
+				current_ = current_->next_.load(std::memory_order_acquire);
+				return *this;
+			}
+
+			const_iterator operator++(int) noexcept
+			{
+				auto tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			friend bool operator==(const const_iterator&, const const_iterator&) noexcept = default;
+
+		private:
+			explicit const_iterator(const node_* node) noexcept
+				: current_{ node }
+			{}
+
+			const node_* current_ = nullptr;
+		};
+
+		class read_guard
+		{
+			friend class rcu_list;
+
+		public:
+			read_guard(const read_guard&) = delete;
+			read_guard& operator=(const read_guard&) = delete;
+
+			~read_guard()
+			{
+				if (--reader_->depth_ == 0)
+				{
+					reader_->epoch_.store(0, std::memory_order_release);
+				}
+			}
+
+			const_iterator begin() const noexcept
+			{
+				return const_iterator{ list_->head_.load(std::memory_order_acquire) };
+			}
+
+			const_iterator end() const noexcept
+			{
+				return const_iterator{};
+			}
+
+			[[nodiscard]]
+			bool empty() const noexcept
+			{
+				return list_->head_.load(std::memory_order_acquire) == nullptr;
+			}
+
+		private:
+			read_guard(const rcu_list& list, slot_& slot) noexcept
+				: list_{ &list }
+				, reader_{ &slot }
+			{
+				if (reader_->depth_++ == 0)
+				{
+					reader_->epoch_.store(list_->epoch_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+				}
+			}
+
+			const rcu_list* list_;
+			slot_* reader_;
+		};
+
+		rcu_list() = default;
+
+		explicit rcu_list(const Allocator& alloc)
+			: alloc_(alloc)
+		{}
+
+		rcu_list(const rcu_list&) = delete;
+		rcu_list& operator=(const rcu_list&) = delete;
+
+		~rcu_list()
+		{
+			this->free_chain_(head_.load(std::memory_order_relaxed));
+
+			for (const retired_& retired : retired_list_)
+			{
+				this->free_node_(retired.target_);
+			}
+
+			for (slot_* slot = slots_.load(std::memory_order_relaxed); slot;)
+			{
+				delete std::exchange(slot, slot->next_);
+			}
+		}
+
+		[[nodiscard]]
+		read_guard read() const
+		{
+			return read_guard(*this, this->local_slot_());
+		}
+
+		template <typename F>
+		void for_each(F f) const
+		{
+			const read_guard guard = this->read();
+
+			for (const T& value : guard)
+			{
+				std::invoke(f, value);
+			}
+		}
+
+		template <typename ... Args>
+		void emplace_front(Args&& ... args)
+		{
+			std::scoped_lock lock{ writer_ };
+			node_* node = this->make_node_(std::forward<Args>(args)...);
+			node_* head = head_.load(std::memory_order_relaxed);
+			node->next_.store(head, std::memory_order_relaxed);
+
+			if (!head)
+			{
+				tail_ = node;
+			}
+
+			head_.store(node, std::memory_order_release);
+			size_.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		template <typename ... Args>
+		void emplace_back(Args&& ... args)
+		{
+			std::scoped_lock lock{ writer_ };
+			node_* node = this->make_node_(std::forward<Args>(args)...);
+			this->link_back_(node, node, 1);
+		}
+
+		void push_front(const T& value)
+		{
+			this->emplace_front(value);
+		}
+
+		void push_front(T&& value)
+		{
+			this->emplace_front(std::move(value));
+		}
+
+		void push_back(const T& value)
+		{
+			this->emplace_back(value);
+		}
+
+		void push_back(T&& value)
+		{
+			this->emplace_back(std::move(value));
+		}
+
+		template <typename Pred, typename ... Args>
+		bool emplace_after_first(Pred pred, Args&& ... args)
+		{
+			std::scoped_lock lock{ writer_ };
+
+			for (node_* node = head_.load(std::memory_order_relaxed); node; node = node->next_.load(std::memory_order_relaxed))
+			{
+				if (std::invoke(pred, std::as_const(node->value_)))
+				{
+					node_* inserted = this->make_node_(std::forward<Args>(args)...);
+					inserted->next_.store(node->next_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+					node->next_.store(inserted, std::memory_order_release);
+
+					if (tail_ == node)
+					{
+						tail_ = inserted;
+					}
+
+					size_.fetch_add(1, std::memory_order_relaxed);
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		template <typename Pred>
+		size_type erase_if(Pred pred)
+		{
+			std::scoped_lock lock{ writer_ };
+			size_type erased = 0;
+			node_* prev = nullptr;
+			node_* node = head_.load(std::memory_order_relaxed);
+
+			while (node)
+			{
+				node_* next = node->next_.load(std::memory_order_relaxed);
+
+				if (std::invoke(pred, std::as_const(node->value_)))
+				{
+					(prev ? prev->next_ : head_).store(next, std::memory_order_release);
+					this->retire_(node);
+					++erased;
+
+					if (tail_ == node)
+					{
+						tail_ = prev;
+					}
+				}
+				else
+				{
+					prev = node;
+				}
+
+				node = next;
+			}
+
+			size_.fetch_sub(erased, std::memory_order_relaxed);
+			this->collect_();
+			return erased;
+		}
+
+		size_type remove(const T& value)
+		{
+			return this->erase_if([&](const T& element) { return element == value; });
+		}
+
+		void splice_back(rcu_list& other)
+		{
+			if (this == &other)
+			{
+				return;
+			}
+
+			if constexpr (!traits::is_always_equal::value)
+			{
+				if (alloc_ != other.alloc_)
+				{
+					throw std::invalid_argument("rcu_list::splice_back: allocators differ");
+				}
+			}
+
+			if (other.local_slot_().depth_ != 0)
+			{
+				throw std::logic_error("rcu_list::splice_back: calling thread holds a read_guard on the source");
+			}
+
+			std::scoped_lock lock{ writer_, other.writer_ };
+			node_* first = other.head_.load(std::memory_order_relaxed);
+
+			if (!first)
+			{
+				return;
+			}
+
+			other.head_.store(nullptr, std::memory_order_release);
+			other.wait_for_readers_();
+			this->link_back_(first, std::exchange(other.tail_, nullptr), other.size_.exchange(0, std::memory_order_relaxed));
+		}
+
+		template <typename ... Policies>
+		void append_moved(list<T, Allocator, Policies...>&& source)
+		{
+			std::scoped_lock lock{ writer_ };
+			node_* first = nullptr;
+			node_* last = nullptr;
+			size_type count = 0;
+
+			try
+			{
+				for (T& value : source)
+				{
+					node_* node = this->make_node_(std::move(value));
+
+					if (last)
+					{
+						last->next_.store(node, std::memory_order_relaxed);
+					}
+					else
+					{
+						first = node;
+					}
+
+					last = node;
+					++count;
+				}
+			}
+			catch (...)
+			{
+				this->free_chain_(first);
+				throw;
+			}
+
+			source.clear();
+
+			if (first)
+			{
+				this->link_back_(first, last, count);
+			}
+		}
+
+		void clear()
+		{
+			std::scoped_lock lock{ writer_ };
+			node_* node = head_.exchange(nullptr, std::memory_order_acq_rel);
+			tail_ = nullptr;
+			size_.store(0, std::memory_order_relaxed);
+
+			while (node)
+			{
+				node_* next = node->next_.load(std::memory_order_relaxed);
+				this->retire_(node);
+				node = next;
+			}
+
+			this->collect_();
+		}
+
+		size_type reclaim()
+		{
+			std::scoped_lock lock{ writer_ };
+			return this->collect_();
+		}
+
+		[[nodiscard]]
+		size_type size() const noexcept
+		{
+			return size_.load(std::memory_order_relaxed);
+		}
+
+		[[nodiscard]]
+		size_type pending_reclaim() const
+		{
+			std::scoped_lock lock{ writer_ };
+			return retired_list_.size();
+		}
+
+		allocator_type get_allocator() const noexcept
+		{
+			return static_cast<allocator_type>(alloc_);
+		}
+
+	private:
+		static std::uint64_t next_id_() noexcept
+		{
+			static std::atomic<std::uint64_t> counter = 0;
+			return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+
+		slot_& local_slot_() const
+		{
+			thread_local memo_ memo;
+
+			if (memo.list_ == id_)
+			{
+				return *memo.entry_;
+			}
+
+			const std::thread::id self = std::this_thread::get_id();
+			slot_* head = slots_.load(std::memory_order_acquire);
+			slot_* slot = head;
+
+			while (slot && slot->thread_ != self)
+			{
+				slot = slot->next_;
+			}
+
+			if (!slot)
+			{
+				slot = new slot_{ self, head };
+
+				while (!slots_.compare_exchange_weak(slot->next_, slot, std::memory_order_release, std::memory_order_acquire))
+				{}
+			}
+
+			memo = { id_, slot };
+			return *slot;
+		}
+
+		template <typename ... Args>
+		node_* make_node_(Args&& ... args)
+		{
+			node_* node = traits::allocate(alloc_, 1);
+
+			try
+			{
+				traits::construct(alloc_, node, std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				traits::deallocate(alloc_, node, 1);
+				throw;
+			}
+
+			return node;
+		}
+
+		void free_node_(node_* node) noexcept
+		{
+			traits::destroy(alloc_, node);
+			traits::deallocate(alloc_, node, 1);
+		}
+
+		void free_chain_(node_* node) noexcept
+		{
+			while (node)
+			{
+				this->free_node_(std::exchange(node, node->next_.load(std::memory_order_relaxed)));
+			}
+		}
+
+		void link_back_(node_* first, node_* last, size_type count) noexcept
+		{
+			(tail_ ? tail_->next_ : head_).store(first, std::memory_order_release);
+			tail_ = last;
+			size_.fetch_add(count, std::memory_order_relaxed);
+		}
+
+		void retire_(node_* node)
+		{
+			retired_list_.push_back({ node, epoch_.load(std::memory_order_relaxed) });
+		}
+
+		void wait_for_readers_()
+		{
+			const std::uint64_t target = epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			for (const slot_* slot = slots_.load(std::memory_order_acquire); slot; slot = slot->next_)
+			{
+				for (std::uint64_t epoch = slot->epoch_.load(std::memory_order_acquire); epoch != 0 && epoch < target;
+					epoch = slot->epoch_.load(std::memory_order_acquire))
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		size_type collect_()
+		{
+			if (retired_list_.empty())
+			{
+				return 0;
+			}
+
+			epoch_.fetch_add(1, std::memory_order_seq_cst);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			std::uint64_t oldest = std::numeric_limits<std::uint64_t>::max();
+
+			for (const slot_* slot = slots_.load(std::memory_order_acquire); slot; slot = slot->next_)
+			{
+				if (const std::uint64_t epoch = slot->epoch_.load(std::memory_order_acquire); epoch != 0)
+				{
+					oldest = std::min(oldest, epoch);
+				}
+			}
+
+			const auto expired = std::ranges::partition(retired_list_,
+				[&](const retired_& retired) { return retired.epoch_ >= oldest; });
+
+			for (const retired_& retired : expired)
+			{
+				this->free_node_(retired.target_);
+			}
+
+			const size_type freed = static_cast<size_type>(expired.size());
+			retired_list_.erase(expired.begin(), expired.end());
+			return freed;
+		}
+
+		std::atomic<node_*> head_ = nullptr;
+		node_* tail_ = nullptr;
+		std::atomic<size_type> size_ = 0;
+		std::atomic<std::uint64_t> epoch_ = 1;
+		mutable std::atomic<slot_*> slots_ = nullptr;
+		mutable std::mutex writer_;
+		std::vector<retired_> retired_list_;
+		const std::uint64_t id_ = next_id_();
+		[[no_unique_address]] node_allocator alloc_;
+	};
+}
+
+#endif // CONSTEXPR_LIST_RCU_LIST
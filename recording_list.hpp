@@ -0,0 +1,445 @@
+#ifndef CONSTEXPR_LIST_RECORDING_LIST
+#define CONSTEXPR_LIST_RECORDING_LIST
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include "constexpr_list.hpp"
+
+namespace constexpr_list
+{
+	enum class trace_op : std::uint8_t
+	{
+		create_list,
+		destroy_list,
+		push_back,
+		push_front,
+		insert,
+		erase,
+		pop_front,
+		pop_back,
+		splice,
+		splice_one,
+		splice_range,
+		sort,
+		merge,
+		clear,
+		count_
+	};
+
+	struct trace_record
+	{
+		trace_op op;
+		std::uint32_t list;
+		std::array<std::uint64_t, 4> args;
+	};
+
+	constexpr std::size_t trace_arity(trace_op op) noexcept
+	{
+		switch (op)
+		{
+		case trace_op::push_back:
+		case trace_op::push_front:
+		case trace_op::erase:
+		case trace_op::merge:
+			return 1;
+		case trace_op::insert:
+		case trace_op::splice:
+			return 2;
+		case trace_op::splice_one:
+			return 3;
+		case trace_op::splice_range:
+			return 4;
+		default:
+			return 0;
+		}
+	}
+
+	namespace detail
+	{
+		inline constexpr char trace_magic[4] = { 'C', 'L', 'T', '1' };
+
+		struct file_closer
+		{
+			void operator()(std::FILE* file) const noexcept
+			{
+				std::fclose(file);
+			}
+		};
+
+		using trace_file = std::unique_ptr<std::FILE, file_closer>;
+
+		inline trace_file open_trace(const char* path, const char* mode)
+		{
+			trace_file file{ std::fopen(path, mode) };
+
+			if (!file)
+			{
+				throw std::system_error(errno, std::generic_category(), "fopen");
+			}
+
+			return file;
+		}
+
+		struct trace_value
+		{
+			template <typename T>
+			constexpr std::uint64_t operator()(const T& value) const noexcept
+			{
+				return static_cast<std::uint64_t>(value);
+			}
+		};
+	}
+
+	template <typename T, typename List, typename Encode>
+	class recording_list;
+
+	class trace_recorder
+	{
+		template <typename T, typename List, typename Encode>
+		friend class recording_list;
+
+	public:
+		explicit trace_recorder(const char* path)
+			: file_{ detail::open_trace(path, "wb") }
+		{
+			this->write_(detail::trace_magic, sizeof(detail::trace_magic));
+		}
+
+		trace_recorder(const trace_recorder&) = delete;
+		trace_recorder& operator=(const trace_recorder&) = delete;
+
+		void record(const trace_record& record)
+		{
+			std::uint8_t buffer[1 + 5 + 4 * 10];
+			std::size_t length = 0;
+
+			buffer[length++] = static_cast<std::uint8_t>(record.op);
+			length += encode_(buffer + length, record.list);
+
+			for (std::size_t i = 0; i < trace_arity(record.op); ++i)
+			{
+				length += encode_(buffer + length, record.args[i]);
+			}
+
+			this->write_(buffer, length);
+			++records_;
+		}
+
+		void flush()
+		{
+			if (std::fflush(file_.get()) != 0)
+			{
+				throw std::system_error(errno, std::generic_category(), "fflush");
+			}
+		}
+
+		[[nodiscard]]
+		std::size_t records() const noexcept
+		{
+			return records_;
+		}
+
+	private:
+		std::uint32_t open_list_() noexcept
+		{
+			return lists_++;
+		}
+
+		std::uint64_t assign_id_(const void* element)
+		{
+			ids_.emplace(element, ++last_id_);
+			return last_id_;
+		}
+
+		std::uint64_t id_of_(const void* element) const
+		{
+			return element ? ids_.at(element) : 0;
+		}
+
+		std::uint64_t release_id_(const void* element)
+		{
+			const auto it = ids_.find(element);
+			const std::uint64_t id = it->second;
+			ids_.erase(it);
+			return id;
+		}
+
+		static std::size_t encode_(std::uint8_t* out, std::uint64_t value) noexcept
+		{
+			std::size_t length = 0;
+
+			while (value >= 0x80)
+			{
+				out[length++] = static_cast<std::uint8_t>(value | 0x80);
+				value >>= 7;
+			}
+
+			out[length++] = static_cast<std::uint8_t>(value);
+			return length;
+		}
+
+		void write_(const void* data, std::size_t size)
+		{
+			if (std::fwrite(data, 1, size, file_.get()) != size)
+			{
+				throw std::system_error(errno, std::generic_category(), "fwrite");
+			}
+		}
+
+		detail::trace_file file_;
+		std::unordered_map<const void*, std::uint64_t> ids_;
+		std::uint64_t last_id_ = 0;
+		std::uint32_t lists_ = 0;
+		std::size_t records_ = 0;
+	};
+
+	inline std::vector<trace_record> read_trace(const char* path)
+	{
+		const detail::trace_file file = detail::open_trace(path, "rb");
+		char magic[sizeof(detail::trace_magic)];
+
+		if (std::fread(magic, 1, sizeof(magic), file.get()) != sizeof(magic)
+			|| std::memcmp(magic, detail::trace_magic, sizeof(magic)) != 0)
+		{
+			throw std::system_error(std::make_error_code(std::errc::invalid_argument), "read_trace");
+		}
+
+		const auto decode = [&](std::uint64_t& value)
+		{
+			value = 0;
+
+			for (unsigned shift = 0; shift < 64; shift += 7)
+			{
+				const int byte = std::fgetc(file.get());
+
+				if (byte == EOF)
+				{
+					throw std::system_error(std::make_error_code(std::errc::invalid_argument), "read_trace");
+				}
+
+				value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+
+				if ((byte & 0x80) == 0)
+				{
+					return;
+				}
+			}
+		};
+
+		std::vector<trace_record> records;
+
+		for (int op = std::fgetc(file.get()); op != EOF; op = std::fgetc(file.get()))
+		{
+			if (op >= static_cast<int>(trace_op::count_))
+			{
+				throw std::system_error(std::make_error_code(std::errc::invalid_argument), "read_trace");
+			}
+
+			trace_record& record = records.emplace_back(static_cast<trace_op>(op));
+			std::uint64_t list;
+			decode(list);
+			record.list = static_cast<std::uint32_t>(list);
+
+			for (std::size_t i = 0; i < trace_arity(record.op); ++i)
+			{
+				decode(record.args[i]);
+			}
+		}
+
+		return records;
+	}
+
+	template <typename T, typename List = list<T>, typename Encode = detail::trace_value>
+	class recording_list
+	{
+	public:
+		using list_type = List;
+		using value_type = T;
+		using size_type = typename List::size_type;
+		using iterator = typename List::iterator;
+		using const_iterator = typename List::const_iterator;
+
+		explicit recording_list(trace_recorder& recorder, const Encode& encode = Encode())
+			: recorder_{ std::addressof(recorder) }
+			, id_{ recorder.open_list_() }
+			, encode_(encode)
+		{
+			this->record_(trace_op::create_list);
+		}
+
+		recording_list(const recording_list&) = delete;
+		recording_list& operator=(const recording_list&) = delete;
+
+		~recording_list()
+		{
+			try
+			{
+				this->forget_(list_.begin(), list_.end());
+				this->record_(trace_op::destroy_list);
+			}
+			catch (...)
+			{
+			}
+		}
+
+		void push_back(const T& value)
+		{
+			list_.push_back(value);
+			recorder_->assign_id_(std::addressof(list_.back()));
+			this->record_(trace_op::push_back, encode_(value));
+		}
+
+		void push_front(const T& value)
+		{
+			list_.push_front(value);
+			recorder_->assign_id_(std::addressof(list_.front()));
+			this->record_(trace_op::push_front, encode_(value));
+		}
+
+		iterator insert(const_iterator pos, const T& value)
+		{
+			const std::uint64_t before = this->id_of_(pos);
+			const iterator it = list_.insert(pos, value);
+			recorder_->assign_id_(std::addressof(*it));
+			this->record_(trace_op::insert, before, encode_(value));
+			return it;
+		}
+
+		iterator erase(const_iterator pos)
+		{
+			this->record_(trace_op::erase, recorder_->release_id_(std::addressof(*pos)));
+			return list_.erase(pos);
+		}
+
+		void pop_front()
+		{
+			recorder_->release_id_(std::addressof(list_.front()));
+			list_.pop_front();
+			this->record_(trace_op::pop_front);
+		}
+
+		void pop_back()
+		{
+			recorder_->release_id_(std::addressof(list_.back()));
+			list_.pop_back();
+			this->record_(trace_op::pop_back);
+		}
+
+		void splice(const_iterator pos, recording_list& other)
+		{
+			this->record_(trace_op::splice, this->id_of_(pos), other.id_);
+			list_.splice(pos, other.list_);
+		}
+
+		void splice(const_iterator pos, recording_list& other, const_iterator it)
+		{
+			this->record_(trace_op::splice_one, this->id_of_(pos), other.id_, other.id_of_(it));
+			list_.splice(pos, other.list_, it);
+		}
+
+		void splice(const_iterator pos, recording_list& other, const_iterator first, const_iterator last)
+		{
+			this->record_(trace_op::splice_range, this->id_of_(pos), other.id_, other.id_of_(first), other.id_of_(last));
+			list_.splice(pos, other.list_, first, last);
+		}
+
+		void sort()
+		{
+			list_.sort();
+			this->record_(trace_op::sort);
+		}
+
+		void merge(recording_list& other)
+		{
+			list_.merge(other.list_);
+			this->record_(trace_op::merge, other.id_);
+		}
+
+		void clear()
+		{
+			this->forget_(list_.begin(), list_.end());
+			list_.clear();
+			this->record_(trace_op::clear);
+		}
+
+		iterator begin() noexcept
+		{
+			return list_.begin();
+		}
+
+		const_iterator begin() const noexcept
+		{
+			return list_.begin();
+		}
+
+		iterator end() noexcept
+		{
+			return list_.end();
+		}
+
+		const_iterator end() const noexcept
+		{
+			return list_.end();
+		}
+
+		const T& front() const
+		{
+			return list_.front();
+		}
+
+		const T& back() const
+		{
+			return list_.back();
+		}
+
+		[[nodiscard]]
+		size_type size() const noexcept
+		{
+			return list_.size();
+		}
+
+		[[nodiscard]]
+		bool empty() const noexcept
+		{
+			return list_.empty();
+		}
+
+		const List& base() const noexcept
+		{
+			return list_;
+		}
+
+	private:
+		template <typename ... Args>
+		void record_(trace_op op, Args ... args)
+		{
+			recorder_->record(trace_record{ op, id_, { static_cast<std::uint64_t>(args)... } });
+		}
+
+		std::uint64_t id_of_(const_iterator pos) const
+		{
+			return recorder_->id_of_(pos == list_.end() ? nullptr : std::addressof(*pos));
+		}
+
+		void forget_(const_iterator first, const_iterator last)
+		{
+			for (; first != last; ++first)
+			{
+				recorder_->release_id_(std::addressof(*first));
+			}
+		}
+
+		trace_recorder* recorder_;
+		std::uint32_t id_;
+		[[no_unique_address]] Encode encode_;
+		List list_;
+	};
+}
+
+#endif // CONSTEXPR_LIST_RECORDING_LIST
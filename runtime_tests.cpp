@@ -0,0 +1,1162 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <latch>
+#include <limits>
+#include <numeric>
+#include <print>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "channel.hpp"
+#include "execution.hpp"
+#include "forward_list.hpp"
+#include "lru_cache.hpp"
+#include "arena.hpp"
+#include "mapped_arena.hpp"
+#include "rcu_list.hpp"
+#include "recording_list.hpp"
+#include "stream.hpp"
+#include "thread_aware_allocator.hpp"
+#include "constexpr_list.hpp"
+
+namespace testing
+{
+	using namespace constexpr_list;
+
+	template <std::size_t Index>
+	void runtime_test()
+	{}
+
+	template <typename T>
+	struct offset_allocator
+	{
+		using value_type = T;
+		using pointer = offset_ptr<T>;
+		using const_pointer = offset_ptr<const T>;
+		using void_pointer = offset_ptr<void>;
+		using const_void_pointer = offset_ptr<const void>;
+
+		offset_allocator() = default;
+
+		template <typename U>
+		offset_allocator(const offset_allocator<U>&) noexcept
+		{}
+
+		pointer allocate(std::size_t n)
+		{
+			return pointer{ std::allocator<T>{}.allocate(n) };
+		}
+
+		void deallocate(pointer ptr, std::size_t n) noexcept
+		{
+			std::allocator<T>{}.deallocate(ptr.get(), n);
+		}
+
+		friend bool operator==(const offset_allocator&, const offset_allocator&) = default;
+	};
+
+	static_assert(!is_trivially_relocatable_v<list<int, offset_allocator<int>, heap_sentinel>>);
+	static_assert(!is_trivially_relocatable_v<list<int, mapped_allocator<int>, heap_sentinel>>);
+	static_assert(!is_trivially_relocatable_v<forward_list<int, offset_allocator<int>>>);
+
+	template <>
+	void runtime_test<0>()
+	{
+		using mapped_list = list<int, mapped_allocator<int>>;
+
+		const std::string path = (std::filesystem::temp_directory_path() / "constexpr_list_mapped_test.bin").string();
+		std::remove(path.c_str());
+
+		{
+			mapped_file_arena first(path.c_str(), 1 << 16);
+			mapped_list& values = first.find_or_construct_root<mapped_list>(mapped_allocator<int>(first));
+
+			for (int i = 0; i < 100; ++i)
+			{
+				values.push_back(i);
+			}
+
+			mapped_file_arena second(path.c_str(), 0);
+
+			if (second.header() == first.header())
+			{
+				throw "r0: second mapping not at a different address";
+			}
+
+			mapped_list* remapped = second.find_root<mapped_list>();
+
+			if (remapped == nullptr || remapped->size() != 100 || remapped->back() != 99)
+			{
+				throw "r0: list not readable through second mapping";
+			}
+
+			int expected = 99;
+
+			for (auto it = remapped->rbegin(); it != remapped->rend(); ++it)
+			{
+				if (*it != expected--)
+				{
+					throw "r0: backward traversal through second mapping";
+				}
+			}
+		}
+
+		{
+			mapped_file_arena reopened(path.c_str(), 0);
+			mapped_list& values = reopened.find_or_construct_root<mapped_list>(mapped_allocator<int>(reopened));
+			values.pop_front();
+			values.push_back(100);
+
+			int expected = 1;
+
+			for (int value : values)
+			{
+				if (value != expected++)
+				{
+					throw "r0: list not intact after reopening";
+				}
+			}
+
+			if (expected != 101)
+			{
+				throw "r0: list length changed after reopening";
+			}
+
+			reopened.destroy_root<mapped_list>();
+		}
+
+		try
+		{
+			mapped_file_arena arena(path.c_str(), 0);
+			mapped_allocator<long>(arena).allocate(static_cast<std::size_t>(-1) / 4);
+			throw "r0: overflowing allocation succeeded";
+		}
+		catch (const std::bad_array_new_length&)
+		{
+		}
+
+		std::remove(path.c_str());
+	}
+
+	template <typename T>
+	struct tagged_allocator : std::allocator<T>
+	{
+		explicit tagged_allocator(int tag) noexcept
+			: tag_{ tag }
+		{}
+
+		template <typename U>
+		tagged_allocator(const tagged_allocator<U>& other) noexcept
+			: tag_{ other.tag_ }
+		{}
+
+		using is_always_equal = std::false_type;
+
+		friend bool operator==(const tagged_allocator& lhs, const tagged_allocator& rhs) noexcept
+		{
+			return lhs.tag_ == rhs.tag_;
+		}
+
+		int tag_;
+	};
+
+	template <typename T>
+	std::vector<T> snapshot(const concurrent::rcu_list<T, tagged_allocator<T>>& values)
+	{
+		std::vector<T> result;
+		values.for_each([&](const T& value) { result.push_back(value); });
+		return result;
+	}
+
+	struct destruction_counter
+	{
+		explicit destruction_counter(int& count) noexcept
+			: count_{ &count }
+		{}
+
+		destruction_counter(destruction_counter&& other) noexcept
+			: count_{ std::exchange(other.count_, nullptr) }
+		{}
+
+		~destruction_counter()
+		{
+			if (count_)
+			{
+				++*count_;
+			}
+		}
+
+		int* count_;
+	};
+
+	async::detached_task push_one(async::channel<int>& ch, int value, std::optional<bool>& accepted)
+	{
+		accepted = co_await ch.push(value);
+	}
+
+	async::detached_task pop_all(async::channel<int>& ch, std::vector<int>& values, bool& done)
+	{
+		while (std::optional<int> value = co_await ch.pop())
+		{
+			values.push_back(*value);
+		}
+
+		done = true;
+	}
+
+	async::detached_task pop_some(async::channel<int>& ch, std::size_t count, list<int>& values)
+	{
+		values = co_await ch.pop_batch(count);
+	}
+
+	async::detached_task never_resumed(destruction_counter)
+	{
+		co_return;
+	}
+
+	async::detached_task sum_all(async::channel<int>& ch, long& sum, std::latch& done)
+	{
+		for (list<int> values = co_await ch.pop_batch(64); !values.empty(); values = co_await ch.pop_batch(64))
+		{
+			for (int value : values)
+			{
+				sum += value;
+			}
+		}
+
+		done.count_down();
+	}
+
+	async::detached_task push_range(async::channel<int>& ch, int count)
+	{
+		for (int i = 1; i <= count; ++i)
+		{
+			co_await ch.push(i);
+		}
+
+		ch.close();
+	}
+
+	template <>
+	void runtime_test<1>()
+	{
+		async::single_thread_executor executor;
+		async::channel<int> ch(executor, 2);
+
+		if (!ch.try_push(1) || !ch.try_push(2) || ch.try_push(3) || ch.size() != 2)
+		{
+			throw "r1: try_push ignored capacity";
+		}
+
+		std::optional<bool> accepted;
+		async::spawn(executor, push_one(ch, 3, accepted));
+		executor.run();
+
+		if (accepted || ch.size() != 2)
+		{
+			throw "r1: push on a full channel did not suspend";
+		}
+
+		if (ch.try_pop() != 1 || executor.run() != 1 || accepted != true || ch.size() != 2)
+		{
+			throw "r1: pop did not admit the suspended pusher";
+		}
+
+		list<int> batch;
+		async::spawn(executor, pop_some(ch, 8, batch));
+		executor.run();
+
+		if (batch != list<int>{ 2, 3 } || ch.size() != 0)
+		{
+			throw "r1: pop_batch did not take every queued item";
+		}
+
+		std::vector<int> popped;
+		bool done = false;
+		async::spawn(executor, pop_all(ch, popped, done));
+		executor.run();
+
+		if (!ch.try_push(4) || ch.size() != 0 || executor.run() != 1 || popped != std::vector{ 4 })
+		{
+			throw "r1: push did not hand over to the suspended popper";
+		}
+
+		ch.close();
+		executor.run();
+
+		if (!done || !ch.closed())
+		{
+			throw "r1: close did not wake the suspended popper";
+		}
+
+		accepted.reset();
+		async::spawn(executor, push_one(ch, 5, accepted));
+		executor.run();
+
+		if (ch.try_push(5) || accepted != false || ch.try_pop())
+		{
+			throw "r1: closed channel accepted a value";
+		}
+
+		async::channel<int> draining(executor);
+		draining.try_push(6);
+		draining.close();
+		popped.clear();
+		done = false;
+		async::spawn(executor, pop_all(draining, popped, done));
+		executor.run();
+
+		if (!done || popped != std::vector{ 6 })
+		{
+			throw "r1: pop after close did not drain queued values";
+		}
+	}
+
+	template <>
+	void runtime_test<2>()
+	{
+		int destroyed = 0;
+
+		{
+			async::single_thread_executor executor;
+			async::spawn(executor, never_resumed(destruction_counter{ destroyed }));
+		}
+
+		{
+			async::thread_pool_executor executor(0);
+			async::spawn(executor, never_resumed(destruction_counter{ destroyed }));
+		}
+
+		if (destroyed != 2)
+		{
+			throw "r2: executor leaked pending coroutines";
+		}
+
+		long sum = 0;
+		std::latch done(1);
+
+		{
+			async::thread_pool_executor executor(2);
+			async::channel<int> ch(executor, 16);
+			async::spawn(executor, sum_all(ch, sum, done));
+			async::spawn(executor, push_range(ch, 10'000));
+			done.wait();
+		}
+
+		if (sum != 10'000 * 10'001 / 2)
+		{
+			throw "r2: values lost across threads";
+		}
+	}
+
+	template <>
+	void runtime_test<3>()
+	{
+		constexpr std::size_t bytes = 32;
+		constexpr std::size_t alignment = alignof(std::max_align_t);
+
+		thread_aware_pool pool(4);
+		std::vector<void*> blocks;
+
+		for (int i = 0; i < 8; ++i)
+		{
+			blocks.push_back(pool.allocate(bytes, alignment));
+		}
+
+		pool.deallocate(blocks[0], bytes, alignment);
+
+		if (pool.allocate(bytes, alignment) != blocks[0])
+		{
+			throw "r3: local free not reused";
+		}
+
+		std::size_t sent_before_flush = 0;
+
+		std::jthread([&]
+		{
+			for (int i = 1; i <= 5; ++i)
+			{
+				pool.deallocate(blocks[i], bytes, alignment);
+			}
+
+			sent_before_flush = pool.stats().batches_sent;
+			pool.flush();
+		}).join();
+
+		if (sent_before_flush != 1)
+		{
+			throw "r3: full batch not handed back";
+		}
+
+		std::vector<void*> reused;
+
+		for (int i = 0; i < 5; ++i)
+		{
+			reused.push_back(pool.allocate(bytes, alignment));
+		}
+
+		std::ranges::sort(reused);
+		std::vector<void*> freed(blocks.begin() + 1, blocks.begin() + 6);
+		std::ranges::sort(freed);
+
+		if (reused != freed)
+		{
+			throw "r3: remote frees not returned to the owning thread";
+		}
+
+		const thread_aware_stats stats = pool.stats();
+
+		if (stats.allocations != 14 || stats.local_frees != 1 || stats.remote_frees != 5
+			|| stats.batches_sent != 2 || stats.batches_received != 2)
+		{
+			throw "r3: pool statistics";
+		}
+
+		for (void* block : reused)
+		{
+			pool.deallocate(block, bytes, alignment);
+		}
+
+		for (int i = 0; i < 8; ++i)
+		{
+			if (i < 1 || i > 5)
+			{
+				pool.deallocate(blocks[i], bytes, alignment);
+			}
+		}
+	}
+
+	template <>
+	void runtime_test<4>()
+	{
+		using rcu = concurrent::rcu_list<int, tagged_allocator<int>>;
+
+		rcu values(tagged_allocator<int>{ 1 });
+
+		for (int i = 1; i <= 5; ++i)
+		{
+			values.push_back(i);
+		}
+
+		values.push_front(0);
+
+		if (!values.emplace_after_first([](int value) { return value == 3; }, 30)
+			|| values.emplace_after_first([](int value) { return value == 99; }, 0)
+			|| !values.emplace_after_first([](int value) { return value == 5; }, 50))
+		{
+			throw "r4: emplace_after_first";
+		}
+
+		values.push_back(6);
+
+		if (snapshot(values) != std::vector{ 0, 1, 2, 3, 30, 4, 5, 50, 6 } || values.size() != 9)
+		{
+			throw "r4: insertion order";
+		}
+
+		{
+			const rcu::read_guard guard = values.read();
+			const rcu::const_iterator erased = std::ranges::next(guard.begin());
+
+			if (values.erase_if([](int value) { return value % 2 == 1; }) != 3 || values.pending_reclaim() != 3)
+			{
+				throw "r4: erase_if freed nodes under a live reader";
+			}
+
+			if (*erased != 1 || *std::ranges::next(erased) != 2)
+			{
+				throw "r4: reader lost an erased node";
+			}
+		}
+
+		if (values.reclaim() != 3 || values.pending_reclaim() != 0 || values.size() != 6)
+		{
+			throw "r4: reclaim after the reader left";
+		}
+
+		rcu other(tagged_allocator<int>{ 1 });
+		other.push_back(7);
+		other.push_back(8);
+
+		{
+			const rcu::read_guard guard = other.read();
+
+			try
+			{
+				values.splice_back(other);
+				throw "r4: splice_back waited on the calling thread's own reader";
+			}
+			catch (const std::logic_error&)
+			{
+			}
+		}
+
+		values.splice_back(other);
+		other.push_back(9);
+
+		if (snapshot(values) != std::vector{ 0, 2, 30, 4, 50, 6, 7, 8 } || snapshot(other) != std::vector{ 9 })
+		{
+			throw "r4: splice_back";
+		}
+
+		rcu foreign(tagged_allocator<int>{ 2 });
+		foreign.push_back(10);
+
+		try
+		{
+			values.splice_back(foreign);
+			throw "r4: splice_back accepted nodes from an unequal allocator";
+		}
+		catch (const std::invalid_argument&)
+		{
+		}
+
+		list<int, tagged_allocator<int>> source({ 11, 12 }, tagged_allocator<int>{ 3 });
+		values.append_moved(std::move(source));
+
+		if (!source.empty() || values.size() != 10 || snapshot(values).back() != 12)
+		{
+			throw "r4: append_moved";
+		}
+
+		values.clear();
+
+		if (values.size() != 0 || !values.read().empty() || values.pending_reclaim() != 0)
+		{
+			throw "r4: clear";
+		}
+	}
+
+	struct throwing_eviction
+	{
+		void operator()(int key, int) const
+		{
+			if (key == *refused_)
+			{
+				throw std::runtime_error("eviction refused");
+			}
+		}
+
+		const int* refused_;
+	};
+
+	template <>
+	void runtime_test<5>()
+	{
+		int refused = 1;
+		lru_cache<int, int, std::hash<int>, std::equal_to<int>, throwing_eviction> cache(2, {}, {}, throwing_eviction{ &refused });
+		cache.put(1, 10);
+		cache.put(2, 20);
+
+		try
+		{
+			cache.put(3, 30);
+			throw "r5: eviction callback did not throw";
+		}
+		catch (const std::runtime_error&)
+		{
+		}
+
+		if (cache.size() != 1 || cache.contains(1) || cache.contains(3) || cache.peek(2) == nullptr || *cache.peek(2) != 20)
+		{
+			throw "r5: table inconsistent after a throwing eviction";
+		}
+
+		cache.put(3, 30);
+		cache.put(4, 40);
+
+		if (cache.size() != 2 || cache.contains(2) || !cache.contains(3) || !cache.contains(4))
+		{
+			throw "r5: eviction after a throwing callback";
+		}
+
+		refused = 3;
+
+		try
+		{
+			cache.put(5, 50);
+			throw "r5: eviction callback did not throw";
+		}
+		catch (const std::runtime_error&)
+		{
+		}
+
+		cache.put(1, 10);
+
+		if (cache.size() != 2 || !cache.contains(4) || !cache.contains(1) || cache.contains(3) || cache.contains(5))
+		{
+			throw "r5: reinsertion after a throwing eviction";
+		}
+	}
+
+	template <>
+	void runtime_test<6>()
+	{
+		using mapped_list = list<int, mapped_allocator<int>>;
+
+		const std::string path = (std::filesystem::temp_directory_path() / "constexpr_list_exhaustion_test.bin").string();
+		std::remove(path.c_str());
+
+		{
+			mapped_file_arena arena(path.c_str(), 4096);
+			mapped_list& values = arena.find_or_construct_root<mapped_list>(mapped_allocator<int>(arena));
+			int pushed = 0;
+
+			try
+			{
+				for (;; ++pushed)
+				{
+					values.push_back(pushed);
+				}
+			}
+			catch (const std::bad_alloc&)
+			{
+			}
+
+			if (pushed == 0 || values.size() != static_cast<std::size_t>(pushed) || values.back() != pushed - 1)
+			{
+				throw "r6: exhaustion left the list inconsistent";
+			}
+
+			const std::size_t used = arena.used();
+			values.remove_if([](int value) { return value % 2 == 0; });
+			const std::size_t erased = static_cast<std::size_t>(pushed) - values.size();
+
+			for (std::size_t i = 0; i < erased; ++i)
+			{
+				values.push_front(-1);
+			}
+
+			if (arena.used() != used || values.size() != static_cast<std::size_t>(pushed))
+			{
+				throw "r6: freed nodes not reused";
+			}
+
+			try
+			{
+				values.push_back(0);
+				throw "r6: exhausted arena accepted another node";
+			}
+			catch (const std::bad_alloc&)
+			{
+			}
+
+			if (values.size() != static_cast<std::size_t>(pushed) || values.front() != -1 || values.back() != pushed - 1)
+			{
+				throw "r6: failed push changed the list";
+			}
+
+			arena.destroy_root<mapped_list>();
+		}
+
+		std::remove(path.c_str());
+	}
+
+	template <>
+	void runtime_test<7>()
+	{
+		list<long> values;
+
+		for (long i = 0; i < 1000; ++i)
+		{
+			values.push_back(i * i - 500);
+		}
+
+		std::stringstream stream;
+
+		if (!to_stream(stream, values, 64))
+		{
+			throw "r7: to_stream failed";
+		}
+
+		const std::string bytes = stream.str();
+
+		if (bytes.size() != values.serialized_size())
+		{
+			throw "r7: streamed size";
+		}
+
+		if (from_stream<list<long>>(stream, {}, 64) != values)
+		{
+			throw "r7: round trip through a stream";
+		}
+
+		std::stringstream empty;
+		to_stream(empty, list<long>{});
+
+		if (!from_stream<list<long>>(empty).empty())
+		{
+			throw "r7: round trip of an empty list";
+		}
+
+		for (const std::size_t cut : { std::size_t{ 0 }, list<long>::serialized_header_size - 1, bytes.size() - 1 })
+		{
+			std::istringstream truncated(bytes.substr(0, cut));
+
+			try
+			{
+				static_cast<void>(from_stream<list<long>>(truncated, {}, 64));
+				throw "r7: truncated stream loaded";
+			}
+			catch (const std::invalid_argument&)
+			{
+			}
+		}
+
+		std::istringstream mismatched(bytes);
+
+		try
+		{
+			static_cast<void>(from_stream<list<int>>(mismatched));
+			throw "r7: element size mismatch loaded";
+		}
+		catch (const std::invalid_argument&)
+		{
+		}
+	}
+
+	template <typename T>
+	void check_block_kernels()
+	{
+		const T needle = static_cast<T>(-3);
+		T filler = static_cast<T>(needle + 1);
+
+		if constexpr (std::is_integral_v<T> && sizeof(T) > 1)
+		{
+			filler = static_cast<T>(needle + (T{ 1 } << (sizeof(T) * 4)));
+		}
+
+		constexpr std::size_t length = 40;
+
+		for (const std::size_t position : { std::size_t{ 3 }, std::size_t{ 28 }, std::size_t{ 37 } })
+		{
+			list<T> values(length, filler);
+			*std::ranges::next(values.begin(), position) = needle;
+
+			if (values.count(needle) != 1 || values.count(static_cast<T>(needle - 1)) != 0)
+			{
+				throw "r8: block count";
+			}
+
+			if (values.find(needle) != std::ranges::next(values.begin(), position) || values.find(static_cast<T>(needle - 1)) != values.end())
+			{
+				throw "r8: block find";
+			}
+
+			list<T> copy = values;
+
+			if (copy != values || (*std::ranges::next(copy.begin(), position) = filler, copy == values))
+			{
+				throw "r8: block equality";
+			}
+
+			if (values.remove(needle) != 1 || values.size() != length - 1 || values.count(needle) != 0 || values != list<T>(length - 1, filler))
+			{
+				throw "r8: block remove";
+			}
+		}
+
+		list<T> values(length, filler);
+
+		for (const std::size_t position : { std::size_t{ 0 }, std::size_t{ 15 }, std::size_t{ 16 }, std::size_t{ 39 } })
+		{
+			*std::ranges::next(values.begin(), position) = needle;
+		}
+
+		if (values.count(needle) != 4 || values.find(needle) != values.begin() || values.remove(needle) != 4 || values.size() != length - 4)
+		{
+			throw "r8: block matches at the boundaries";
+		}
+
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			list<T> zeros(length, T{ 1 });
+			*std::ranges::next(zeros.begin(), 5) = T{ 0 };
+			*std::ranges::next(zeros.begin(), 36) = -T{ 0 };
+
+			if (zeros.count(-T{ 0 }) != 2 || zeros.find(T{ 0 }) != std::ranges::next(zeros.begin(), 5))
+			{
+				throw "r8: signed zeros compared unequal";
+			}
+
+			list<T> nans(length, std::numeric_limits<T>::quiet_NaN());
+
+			if (nans.count(std::numeric_limits<T>::quiet_NaN()) != 0 || nans.find(std::numeric_limits<T>::quiet_NaN()) != nans.end()
+				|| nans == nans || nans.remove(std::numeric_limits<T>::quiet_NaN()) != 0)
+			{
+				throw "r8: NaN compared equal";
+			}
+		}
+	}
+
+	template <>
+	void runtime_test<8>()
+	{
+		check_block_kernels<std::int8_t>();
+		check_block_kernels<std::int16_t>();
+		check_block_kernels<std::int32_t>();
+		check_block_kernels<std::int64_t>();
+		check_block_kernels<float>();
+		check_block_kernels<double>();
+	}
+
+	struct counting_arena : arena
+	{
+		using arena::arena;
+
+		void* allocate(std::size_t bytes, std::size_t alignment)
+		{
+			++allocations_;
+			return arena::allocate(bytes, alignment);
+		}
+
+		void deallocate(void* ptr, std::size_t bytes) noexcept
+		{
+			++deallocations_;
+			arena::deallocate(ptr, bytes);
+		}
+
+		std::size_t allocations_ = 0;
+		std::size_t deallocations_ = 0;
+	};
+
+	template <>
+	void runtime_test<9>()
+	{
+		using arena_list = list<int, arena_allocator<int, counting_arena>>;
+
+		counting_arena a(4096);
+
+		{
+			arena_list values(a);
+
+			for (int i = 0; i < 1000; ++i)
+			{
+				values.push_back(i);
+			}
+
+			if (a.allocations_ != 1000 || a.blocks() != 3 || a.bytes_reserved() != 4096 + 8192 + 16384)
+			{
+				throw "r9: nodes did not come from the arena";
+			}
+
+			values.clear();
+
+			if (a.deallocations_ != 0 || !values.empty())
+			{
+				throw "r9: clear returned nodes one at a time";
+			}
+
+			for (int i = 0; i < 1000; ++i)
+			{
+				values.push_back(i);
+			}
+		}
+
+		if (a.deallocations_ != 0 || a.allocations_ != 2000 || a.blocks() != 4 || a.bytes_reserved() != 4096 + 8192 + 16384 + 32768)
+		{
+			throw "r9: destructor returned nodes one at a time";
+		}
+
+		{
+			list<std::string, arena_allocator<std::string, counting_arena>> strings(a);
+			strings.push_back("kept");
+			strings.push_back("destroyed");
+			strings.clear();
+
+			if (a.deallocations_ != 2)
+			{
+				throw "r9: nodes with a non-trivial destructor skipped destruction";
+			}
+		}
+
+		try
+		{
+			a.allocate(std::numeric_limits<std::size_t>::max() - 8, 16);
+			throw "r9: overflowing arena allocation succeeded";
+		}
+		catch (const std::bad_alloc&)
+		{
+		}
+
+		a.release();
+
+		if (a.blocks() != 0 || a.bytes_reserved() != 0)
+		{
+			throw "r9: release kept blocks";
+		}
+	}
+
+	template <>
+	void runtime_test<10>()
+	{
+		constexpr std::size_t bytes = 32;
+		constexpr std::size_t alignment = alignof(std::max_align_t);
+		constexpr std::size_t owners = 20;
+
+		thread_aware_pool pool(4);
+		std::vector<void*> blocks(owners);
+		std::latch allocated(owners);
+		std::latch finished(1);
+		std::vector<std::jthread> threads;
+
+		for (void*& block : blocks)
+		{
+			threads.emplace_back([&]
+			{
+				block = pool.allocate(bytes, alignment);
+				allocated.count_down();
+				finished.wait();
+			});
+		}
+
+		allocated.wait();
+
+		for (void* block : blocks)
+		{
+			pool.deallocate(block, bytes, alignment);
+		}
+
+		thread_aware_stats stats = pool.stats();
+		finished.count_down();
+
+		if (stats.remote_frees != owners || stats.batches_sent != 0 || stats.batches_received != owners - 16)
+		{
+			throw "r10: frees past the outbox limit not returned to their owners";
+		}
+
+		pool.flush();
+		stats = pool.stats();
+
+		if (stats.batches_sent != 16 || stats.batches_received != owners)
+		{
+			throw "r10: flush after the outbox limit";
+		}
+	}
+
+	template <>
+	void runtime_test<11>()
+	{
+		using stats_list = list<int, std::allocator<int>, operation_stats>;
+
+		std::vector<int> source(300'000);
+		std::iota(source.begin(), source.end(), 0);
+
+		stats_list values(std::from_range, std::execution::par, source);
+
+		if (values.size() != source.size() || !std::ranges::equal(values, source))
+		{
+			throw "r11: parallel build changed the order";
+		}
+
+		if (std::thread::hardware_concurrency() > 1 && values.stats().relinks < 2)
+		{
+			throw "r11: parallel build ran on one thread";
+		}
+
+		int expected = static_cast<int>(source.size());
+
+		for (stats_list::iterator it = values.end(); it != values.begin();)
+		{
+			if (*--it != --expected)
+			{
+				throw "r11: prev links broken across chain boundaries";
+			}
+		}
+
+		if (expected != 0)
+		{
+			throw "r11: backward walk length";
+		}
+
+		values.append_range(std::execution::par, source);
+
+		if (values.size() != 2 * source.size() || values.back() != source.back() || *std::ranges::next(values.begin(), 300'000) != 0)
+		{
+			throw "r11: parallel append to a non-empty list";
+		}
+	}
+
+	struct bump_buffer
+	{
+		static constexpr std::size_t slot = 32;
+
+		alignas(node_layout::page) std::byte storage_[16 * node_layout::page];
+		std::size_t used_ = 0;
+	};
+
+	template <typename T>
+	struct bump_allocator
+	{
+		using value_type = T;
+
+		explicit bump_allocator(bump_buffer& buffer) noexcept
+			: buffer_{ &buffer }
+		{}
+
+		template <typename U>
+		bump_allocator(const bump_allocator<U>& other) noexcept
+			: buffer_{ other.buffer_ }
+		{}
+
+		T* allocate(std::size_t n)
+		{
+			const std::size_t bytes = (n * sizeof(T) + bump_buffer::slot - 1) / bump_buffer::slot * bump_buffer::slot;
+
+			if (bytes > sizeof(buffer_->storage_) - buffer_->used_)
+			{
+				throw std::bad_alloc{};
+			}
+
+			return reinterpret_cast<T*>(buffer_->storage_ + std::exchange(buffer_->used_, buffer_->used_ + bytes));
+		}
+
+		void deallocate(T*, std::size_t) noexcept
+		{}
+
+		friend bool operator==(const bump_allocator&, const bump_allocator&) = default;
+
+		bump_buffer* buffer_;
+	};
+
+	template <>
+	void runtime_test<12>()
+	{
+		using bump_list = list<std::uint64_t, bump_allocator<std::uint64_t>>;
+
+		const auto buffer = std::make_unique<bump_buffer>();
+		bump_list values(bump_allocator<std::uint64_t>{ *buffer });
+
+		for (std::uint64_t i = 0; i < 2000; ++i)
+		{
+			values.push_back(i);
+		}
+
+		const auto check = [](const node_layout& layout, std::size_t backward)
+		{
+			std::array<std::size_t, node_layout::stride_buckets> expected{};
+			expected[6] = 1999;
+
+			if (layout.nodes != 2000 || layout.backward_strides != backward || layout.stride_histogram != expected)
+			{
+				throw "r12: stride histogram";
+			}
+
+			if (layout.same_cache_line != 1000.0 / 1999 || layout.same_page != 1984.0 / 1999 || layout.pages_per_window != 8.5)
+			{
+				throw "r12: cache line and page locality";
+			}
+		};
+
+		check(values.layout_stats(), 0);
+		values.reverse();
+		check(values.layout_stats(), 1999);
+	}
+
+	template <>
+	void runtime_test<13>()
+	{
+		const std::string path = (std::filesystem::temp_directory_path() / "constexpr_list_trace_test.bin").string();
+
+		{
+			trace_recorder recorder(path.c_str());
+			recording_list<int> a(recorder);
+			recording_list<int> b(recorder);
+
+			a.push_back(10);
+			a.push_back(20);
+			a.push_back(30);
+			b.push_front(300);
+			b.splice(b.begin(), a, std::ranges::next(a.begin()), a.end());
+			a.erase(a.begin());
+			b.clear();
+
+			if (recorder.records() != 9 || !a.empty() || !b.empty())
+			{
+				throw "r13: recorded operations";
+			}
+		}
+
+		const std::vector<trace_record> expected{
+			{ trace_op::create_list, 0, {} },
+			{ trace_op::create_list, 1, {} },
+			{ trace_op::push_back, 0, { 10 } },
+			{ trace_op::push_back, 0, { 20 } },
+			{ trace_op::push_back, 0, { 30 } },
+			{ trace_op::push_front, 1, { 300 } },
+			{ trace_op::splice_range, 1, { 4, 0, 2, 0 } },
+			{ trace_op::erase, 0, { 1 } },
+			{ trace_op::clear, 1, {} },
+			{ trace_op::destroy_list, 1, {} },
+			{ trace_op::destroy_list, 0, {} },
+		};
+
+		const std::vector<trace_record> trace = read_trace(path.c_str());
+
+		if (!std::ranges::equal(trace, expected, [](const trace_record& lhs, const trace_record& rhs)
+			{
+				return lhs.op == rhs.op && lhs.list == rhs.list && lhs.args == rhs.args;
+			}))
+		{
+			throw "r13: trace did not round-trip";
+		}
+
+		std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+
+		try
+		{
+			static_cast<void>(read_trace(path.c_str()));
+			throw "r13: truncated trace loaded";
+		}
+		catch (const std::system_error&)
+		{
+		}
+
+		std::filesystem::resize_file(path, 2);
+
+		try
+		{
+			static_cast<void>(read_trace(path.c_str()));
+			throw "r13: trace without a header loaded";
+		}
+		catch (const std::system_error&)
+		{
+		}
+
+		std::remove(path.c_str());
+	}
+}
+
+int main()
+{
+	int failures = 0;
+
+	[&]<std::size_t ... I>(std::index_sequence<I...>)
+	{
+		([&]
+		{
+			try
+			{
+				testing::runtime_test<I>();
+			}
+			catch (const char* what)
+			{
+				std::println("{}", what);
+				++failures;
+			}
+		}(), ...);
+	}(std::make_index_sequence<32>());
+
+	if (failures == 0)
+	{
+		std::println("all runtime tests passed");
+	}
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+#ifndef CONSTEXPR_LIST_STREAM
+#define CONSTEXPR_LIST_STREAM
+
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include "constexpr_list.hpp"
+
+namespace constexpr_list
+{
+	namespace detail
+	{
+		template <typename List>
+		struct list_stream
+		{
+			using value_type = typename List::value_type;
+			using size_type = typename List::size_type;
+
+			static std::ostream& write(std::ostream& os, const List& values, std::size_t chunk_bytes)
+			{
+				std::array<std::byte, List::serialized_header_size> header;
+				values.write_header_(header.data());
+				os.write(reinterpret_cast<const char*>(header.data()), header.size());
+
+				const std::size_t chunk_elements = std::max<std::size_t>(chunk_bytes / sizeof(value_type), 1);
+				std::vector<std::byte> chunk(chunk_elements * sizeof(value_type));
+				typename List::const_iterator it = values.begin();
+
+				while (os && it != values.end())
+				{
+					std::byte* cursor = chunk.data();
+
+					for (std::size_t i = 0; i < chunk_elements && it != values.end(); ++i, ++it)
+					{
+						detail::store_bytes(cursor, *it);
+						cursor += sizeof(value_type);
+					}
+
+					os.write(reinterpret_cast<const char*>(chunk.data()), cursor - chunk.data());
+				}
+
+				return os;
+			}
+
+			static List read(std::istream& is, const typename List::allocator_type& alloc, std::size_t chunk_bytes)
+			{
+				std::array<std::byte, List::serialized_header_size> header;
+
+				if (!is.read(reinterpret_cast<char*>(header.data()), header.size()))
+				{
+					throw std::invalid_argument("list::load: truncated header");
+				}
+
+				size_type remaining = List::read_header_(header.data());
+				const std::size_t chunk_elements = std::max<std::size_t>(chunk_bytes / sizeof(value_type), 1);
+				std::vector<std::byte> chunk(chunk_elements * sizeof(value_type));
+				List result(alloc);
+
+				while (remaining)
+				{
+					const size_type count = std::min<size_type>(remaining, chunk_elements);
+
+					if (!is.read(reinterpret_cast<char*>(chunk.data()), count * sizeof(value_type)))
+					{
+						throw std::invalid_argument("list::load: truncated elements");
+					}
+
+					result.append_bytes_(chunk.data(), count);
+					remaining -= count;
+				}
+
+				return result;
+			}
+		};
+	}
+
+	template <typename T, typename Allocator, typename ... Policies>
+		requires std::is_trivially_copyable_v<T>
+	std::ostream& to_stream(std::ostream& os, const list<T, Allocator, Policies...>& values, std::size_t chunk_bytes = 1 << 16)
+	{
+		return detail::list_stream<list<T, Allocator, Policies...>>::write(os, values, chunk_bytes);
+	}
+
+	template <typename List>
+		requires std::is_trivially_copyable_v<typename List::value_type>
+	[[nodiscard]]
+	List from_stream(std::istream& is, const typename List::allocator_type& alloc = typename List::allocator_type(),
+		std::size_t chunk_bytes = 1 << 16)
+	{
+		return detail::list_stream<List>::read(is, alloc, chunk_bytes);
+	}
+}
+
+#endif // CONSTEXPR_LIST_STREAM
@@ -2,8 +2,15 @@
 #include <utility>
 #include <optional>
 #include <print>
+#include <vector>
 
 #include "constexpr_list.hpp"
+#include "arena.hpp"
+#include "forward_list.hpp"
+#include "lru_cache.hpp"
+#include "persistent_list.hpp"
+#include "hot_cold_list.hpp"
+#include "timing_wheel.hpp"
 
 namespace testing{
 
@@ -93,6 +100,96 @@ namespace testing{
 		tracker* tracker_ = nullptr;
 	};
 
+	template <typename T>
+	struct isolated_tracker : allocator_tracker<T>
+	{
+		using allocator_tracker<T>::allocator_tracker;
+
+		template <typename U>
+		constexpr isolated_tracker(const isolated_tracker<U>& other)
+			: allocator_tracker<T>(static_cast<const allocator_tracker<U>&>(other))
+		{}
+
+		friend constexpr bool operator==(const isolated_tracker& lhs, const isolated_tracker& rhs) noexcept
+		{
+			return lhs.tracker_ == rhs.tracker_;
+		}
+	};
+
+	template <typename T>
+	struct fancy_pointer
+	{
+		using element_type = T;
+		using difference_type = std::ptrdiff_t;
+
+		template <typename U>
+		using rebind = fancy_pointer<U>;
+
+		constexpr fancy_pointer() = default;
+		constexpr fancy_pointer(std::nullptr_t) noexcept {}
+		constexpr explicit fancy_pointer(T* ptr) noexcept
+			: ptr_{ ptr }
+		{}
+
+		template <typename U> requires std::is_convertible_v<U*, T*>
+		constexpr fancy_pointer(fancy_pointer<U> other) noexcept
+			: ptr_{ other.ptr_ }
+		{}
+
+		template <typename U> requires std::same_as<U, T> && (!std::is_void_v<U>)
+		static constexpr fancy_pointer pointer_to(U& ref) noexcept
+		{
+			return fancy_pointer{ std::addressof(ref) };
+		}
+
+		constexpr T* operator->() const noexcept
+		{
+			return ptr_;
+		}
+
+		template <typename U = T> requires (!std::is_void_v<U>)
+		constexpr U& operator*() const noexcept
+		{
+			return *ptr_;
+		}
+
+		constexpr explicit operator bool() const noexcept
+		{
+			return ptr_ != nullptr;
+		}
+
+		friend constexpr bool operator==(fancy_pointer, fancy_pointer) = default;
+
+		T* ptr_ = nullptr;
+	};
+
+	template <typename T>
+	struct fancy_allocator
+	{
+		using value_type = T;
+		using pointer = fancy_pointer<T>;
+		using const_pointer = fancy_pointer<const T>;
+		using void_pointer = fancy_pointer<void>;
+		using const_void_pointer = fancy_pointer<const void>;
+
+		fancy_allocator() = default;
+
+		template <typename U>
+		constexpr fancy_allocator(const fancy_allocator<U>&) noexcept {}
+
+		constexpr pointer allocate(std::size_t n)
+		{
+			return pointer{ std::allocator<T>{}.allocate(n) };
+		}
+
+		constexpr void deallocate(pointer p, std::size_t n)
+		{
+			std::allocator<T>{}.deallocate(p.ptr_, n);
+		}
+
+		friend constexpr bool operator==(const fancy_allocator&, const fancy_allocator&) = default;
+	};
+
 	template <typename T>
 	using tracked_list = list<T, allocator_tracker<T>>;
 
@@ -465,6 +562,1064 @@ namespace testing{
 		}
 	}
 
+	template <>
+	constexpr void test<17>(opt_list opt)
+	{
+		using stats_list = list<int, std::allocator<int>, operation_stats>;
+
+		stats_list l1 = { 1, 2, 3 };
+		stats_list l2 = { 4, 5, 6, 7 };
+
+		l1.reset_stats();
+		l1.splice(l1.end(), l2);
+
+		if (l1.stats().relinks != 1 || l1.stats().nodes_visited != 0)
+		{
+			throw "t17: whole list splice not O(1)";
+		}
+
+		if (l1.stats().peak_size != 7 || !l2.empty())
+		{
+			throw "t17: splice did not move all nodes";
+		}
+
+		stats_list l3;
+		for (int i = 0; i < 64; ++i)
+		{
+			l3.push_back((i * 37) % 64);
+		}
+
+		l3.reset_stats();
+		l3.sort();
+
+		if (l3.stats().comparisons > 2 * 64 * 6)
+		{
+			throw "t17: sort exceeded n log n comparisons";
+		}
+
+		if (l3.stats().relinks != 64 || !std::ranges::is_sorted(l3))
+		{
+			throw "t17: sort invalid";
+		}
+
+		l3.reset_stats();
+		l3.erase(l3.begin());
+		l3.pop_back();
+
+		if (l3.stats().erasures != 2)
+		{
+			throw "t17: erasures not counted";
+		}
+
+		static_assert(sizeof(list<int>) == sizeof(stats_list) - sizeof(operation_stats));
+	}
+
+	template <>
+	constexpr void test<18>(opt_list opt)
+	{
+		using lazy_list = list<int, std::allocator<int>, lazy_size, operation_stats>;
+
+		static_assert(!std::ranges::sized_range<lazy_list>);
+
+		lazy_list l1 = { 1, 5 };
+		lazy_list l2 = { 9, 2, 3, 4, 9 };
+
+		l1.reset_stats();
+		l1.splice(std::ranges::next(l1.begin()), l2,
+			std::ranges::next(l2.begin()), std::ranges::prev(l2.end()));
+
+		if (l1.stats().nodes_visited != 0 || l1.stats().relinks != 1)
+		{
+			throw "t18: range splice not O(1)";
+		}
+
+		if (std::as_const(l1).size() != 5 || std::as_const(l2).size() != 2)
+		{
+			throw "t18: const size not counted after splice";
+		}
+
+		if (l1.size() != 5 || l2.size() != 2)
+		{
+			throw "t18: size not recomputed after splice";
+		}
+
+		if (false == std::ranges::equal(l1, std::array{ 1, 2, 3, 4, 5 }))
+		{
+			throw "t18: range not valid after splice";
+		}
+
+		l1.push_back(6);
+		l1.pop_front();
+
+		if (l1.size() != 5 || l1.empty())
+		{
+			throw "t18: memoized size not maintained";
+		}
+
+		l2.clear();
+
+		if (l2.size() != 0 || !l2.empty())
+		{
+			throw "t18: size not reset by clear";
+		}
+	}
+
+	template <>
+	constexpr void test<19>(opt_list opt)
+	{
+		struct identity_hash
+		{
+			constexpr std::size_t operator()(int key) const noexcept
+			{
+				return static_cast<std::size_t>(key);
+			}
+		};
+
+		struct evicted_sum
+		{
+			int* sum;
+
+			constexpr void operator()(int key, int value) const noexcept
+			{
+				*sum += key * 100 + value;
+			}
+		};
+
+		tracker tr;
+		int evicted = 0;
+
+		{
+			lru_cache<int, int, identity_hash, std::equal_to<int>, evicted_sum, allocator_tracker<int>>
+				cache(3, {}, {}, evicted_sum{ &evicted }, tr);
+
+			cache.put(1, 1);
+			cache.put(5, 2);
+			cache.put(9, 3);
+
+			if (cache.get(1) == nullptr || *cache.get(1) != 1)
+			{
+				throw "t19: lookup failed";
+			}
+
+			cache.put(13, 4);
+
+			if (evicted != 502 || cache.contains(5) || cache.size() != 3)
+			{
+				throw "t19: least recently used entry not evicted";
+			}
+
+			cache.put(9, 30);
+			cache.put(17, 5);
+
+			if (evicted != 502 + 101 || cache.get(1) != nullptr || *cache.get(9) != 30)
+			{
+				throw "t19: recency not refreshed by put";
+			}
+
+			if (!cache.erase(13) || cache.erase(13) || cache.get(17) == nullptr || *cache.get(17) != 5)
+			{
+				throw "t19: erase broke probing";
+			}
+		}
+
+		if (tr.allocations != 4 || tr.allocations != tr.deallocations)
+		{
+			throw "t19: eviction allocated new node";
+		}
+
+		{
+			lru_cache<int, int, identity_hash, std::equal_to<int>, evicted_sum, allocator_tracker<int>>
+				cache(2, {}, {}, evicted_sum{ &evicted }, tr);
+
+			cache.put(1, 10);
+			cache.put(3, 30);
+
+			auto copy = cache;
+			cache.clear();
+
+			if (copy.get(1) == nullptr || *copy.get(1) != 10 || !copy.contains(3) || cache.contains(1))
+			{
+				throw "t19: copy shares index with source";
+			}
+
+			copy.put(5, 50);
+			cache = copy;
+			copy.clear();
+
+			if (cache.contains(3) || cache.get(5) == nullptr || *cache.get(1) != 10 || evicted != 603 + 330)
+			{
+				throw "t19: copy assignment lost recency order";
+			}
+		}
+
+		if (tr.allocations != tr.deallocations)
+		{
+			throw "t19: copy leaked";
+		}
+	}
+
+	template <>
+	constexpr void test<20>(opt_list opt)
+	{
+		struct point
+		{
+			int x;
+			int y;
+		};
+
+		using fancy_list = list<point, fancy_allocator<point>>;
+
+		static_assert(std::same_as<fancy_list::pointer, fancy_pointer<point>>);
+		static_assert(std::bidirectional_iterator<fancy_list::const_iterator>);
+
+		fancy_list l;
+
+		for (int i : { 5, 3, 9, 1, 7 })
+		{
+			l.push_back({ i, -i });
+		}
+
+		l.emplace_front(4, -4);
+		l.sort([](const point& lhs, const point& rhs) { return lhs.x < rhs.x; });
+
+		int previous = 0;
+
+		for (auto it = l.cbegin(); it != l.cend(); ++it)
+		{
+			if (it->x <= previous || it->y != -it->x)
+			{
+				throw "t20: sort through fancy pointers";
+			}
+
+			previous = it->x;
+		}
+
+		fancy_list other;
+		other.push_back({ 100, -100 });
+		other.splice(other.begin(), l, std::ranges::next(l.begin()), std::ranges::prev(l.end()));
+		l.reverse();
+
+		if (l.size() != 2 || l.front().x != 9 || l.back().x != 1 || other.size() != 5 || other.back().x != 100)
+		{
+			throw "t20: splice through fancy pointers";
+		}
+
+		fancy_list moved = std::move(other);
+		moved.remove_if([](const point& p) { return p.x % 2 == 0; });
+
+		if (!other.empty() || moved.size() != 3 || moved.front().x != 3 || (--moved.end())->x != 7)
+		{
+			throw "t20: move through fancy pointers";
+		}
+	}
+
+	template <>
+	constexpr void test<21>(opt_list opt)
+	{
+		struct sample
+		{
+			std::int32_t id;
+			std::int32_t flags;
+			double weight;
+		};
+
+		tracker tr;
+		{
+			list<sample, allocator_tracker<sample>> l(tr);
+
+			for (int i = 0; i < 10; ++i)
+			{
+				l.push_back({ i, -i, i * 0.5 });
+			}
+
+			std::array<std::byte, decltype(l)::serialized_header_size + 10 * sizeof(sample)> buffer{};
+
+			if (l.serialized_size() != buffer.size() || l.write_to(buffer).size() != buffer.size())
+			{
+				throw "t21: serialized size";
+			}
+
+			auto loaded = decltype(l)::load(buffer, allocator_tracker<sample>(tr));
+
+			if (loaded.size() != 10 || !std::ranges::equal(l, loaded, {}, &sample::id, &sample::id)
+				|| !std::ranges::equal(l, loaded, {}, &sample::weight, &sample::weight))
+			{
+				throw "t21: loaded list differs";
+			}
+
+			tracked_list<int> empty;
+			std::array<std::byte, tracked_list<int>::serialized_header_size> header{};
+			empty.write_to(header);
+
+			if (!tracked_list<int>::load(header).empty())
+			{
+				throw "t21: empty round trip";
+			}
+		}
+
+		if (tr.allocations != 20 || !tr.valid())
+		{
+			throw "t21: load leaked nodes";
+		}
+	}
+
+	template <>
+	constexpr void test<22>(opt_list opt)
+	{
+		tracker tr;
+		{
+			tracked_list<int> l(tr);
+
+			for (int i = 0; i < 50; ++i)
+			{
+				l.push_back(i % 7);
+			}
+
+			if (l.count(3) != 7 || l.count(9) != 0 || l.count(3L) != 7)
+			{
+				throw "t22: count";
+			}
+
+			if (l.find(6) != std::ranges::next(l.begin(), 6) || l.find(9) != l.end() || *l.find(0) != 0)
+			{
+				throw "t22: find";
+			}
+
+			tracked_list<int> copy = l;
+
+			if (copy != l || (copy.back() = 1, copy == l))
+			{
+				throw "t22: equality";
+			}
+
+			if (l.remove(0) != 8 || l.size() != 42 || l.count(0) != 0 || l.front() != 1)
+			{
+				throw "t22: remove";
+			}
+		}
+
+		if (!tr.valid())
+		{
+			throw "t22: remove leaked";
+		}
+
+		list<double> doubles{ 0.5, -0.0, 2.5, 0.5, 0.0 };
+		list<std::uint8_t> bytes(40, std::uint8_t{ 200 });
+		bytes.push_back(7);
+
+		if (doubles.count(0.0) != 2 || doubles.find(2.5) != std::ranges::next(doubles.begin(), 2)
+			|| bytes.find(std::uint8_t{ 7 }) != std::ranges::prev(bytes.end()) || bytes.count(std::uint8_t{ 200 }) != 40)
+		{
+			throw "t22: block search on other widths";
+		}
+	}
+
+	template <>
+	constexpr void test<23>(opt_list opt)
+	{
+		tracker tr;
+		{
+			using plist = persistent_list<int, allocator_tracker<int>>;
+
+			const plist base(tracked_list<int>({ 3, 4, 5 }, tr));
+			const plist snapshot = base;
+			const plist grown = base.push_front(2).push_front(1);
+
+			if (tr.allocations != 3 + 3 + 2 || base.use_count() != 3 || !std::ranges::equal(grown, std::array{ 1, 2, 3, 4, 5 }))
+			{
+				throw "t23: push_front did not share the tail";
+			}
+
+			const plist tail = grown.pop_front().pop_front();
+
+			if (tail != snapshot || grown.size() != 5 || tail.size() != 3)
+			{
+				throw "t23: pop_front";
+			}
+
+			auto b = grown.transient();
+			b.push_front(0);
+			b.pop_front();
+			b.pop_front();
+			b.push_front(-2);
+			const std::size_t before_unshare = tr.allocations;
+			b.push_back(6);
+
+			if (tr.allocations != before_unshare + 5)
+			{
+				throw "t23: push_back did not copy the shared suffix once";
+			}
+
+			b.push_back(7);
+			const plist edited = std::move(b).persistent();
+
+			if (!std::ranges::equal(edited, std::array{ -2, 2, 3, 4, 5, 6, 7 }) || edited.size() != 7
+				|| !std::ranges::equal(grown, std::array{ 1, 2, 3, 4, 5 }) || !b.empty())
+			{
+				throw "t23: builder changed a snapshot";
+			}
+
+			tracked_list<int> back(std::from_range, edited, edited.get_allocator());
+
+			if (back.size() != 7 || back.back() != 7 || back.front() != -2)
+			{
+				throw "t23: to_list";
+			}
+		}
+
+		if (!tr.valid())
+		{
+			throw "t23: nodes leaked";
+		}
+	}
+
+	template <>
+	constexpr void test<24>(opt_list opt)
+	{
+		tracker tr;
+		{
+			const auto is_even = [](int value) { return value % 2 == 0; };
+			tracked_list<int> l({ 1, 2, 4, 3, 5, 6, 8, 10, 7 }, tr);
+			const std::size_t allocations = tr.allocations;
+			const int* four = std::addressof(*std::ranges::next(l.begin(), 2));
+
+			tracked_list<int> evens = l.split_if(is_even);
+
+			if (tr.allocations != allocations || tr.constructions != allocations
+				|| !std::ranges::equal(evens, std::array{ 2, 4, 6, 8, 10 }) || !std::ranges::equal(l, std::array{ 1, 3, 5, 7 })
+				|| evens.size() != 5 || l.size() != 4 || std::addressof(*std::ranges::next(evens.begin())) != four)
+			{
+				throw "t24: split_if";
+			}
+
+			if (!l.split_if(is_even).empty() || l.size() != 4)
+			{
+				throw "t24: split_if without matches";
+			}
+
+			l.splice(l.end(), evens);
+			auto mid = l.stable_partition(is_even);
+
+			if (!std::ranges::equal(l, std::array{ 2, 4, 6, 8, 10, 1, 3, 5, 7 }) || *mid != 1
+				|| std::ranges::distance(l.begin(), mid) != 5)
+			{
+				throw "t24: stable_partition";
+			}
+
+			l.reverse();
+			mid = l.partition([](int value) { return value < 5; });
+
+			if (std::ranges::distance(l.begin(), mid) != 4 || !std::ranges::all_of(l.begin(), mid, [](int value) { return value < 5; })
+				|| !std::ranges::none_of(mid, l.end(), [](int value) { return value < 5; }) || l.size() != 9)
+			{
+				throw "t24: partition";
+			}
+		}
+
+		if (!tr.valid())
+		{
+			throw "t24: nodes leaked";
+		}
+	}
+
+	template <>
+	constexpr void test<25>(opt_list opt)
+	{
+		tracker tr;
+		{
+			tracked_list<int> l(tr);
+
+			for (int i = 0; i < 100; ++i)
+			{
+				l.push_back(i);
+			}
+
+			auto r = l.detach_for_reclaim();
+
+			if (!l.empty() || l.size() != 0 || r.empty() || tr.deallocations != 0)
+			{
+				throw "t25: detach freed nodes inline";
+			}
+
+			l.push_back(7);
+
+			if (r.reclaim(30) != 30 || tr.deallocations != 30 || tr.destructions != 30)
+			{
+				throw "t25: reclaim ignored the budget";
+			}
+
+			if (r.reclaim(1000) != 70 || !r.empty() || r.reclaim(5) != 0 || l.front() != 7)
+			{
+				throw "t25: reclaim did not drain";
+			}
+
+			auto pending = l.detach_for_reclaim();
+			auto empty = l.detach_for_reclaim();
+
+			if (!empty.empty() || tr.deallocations != 100)
+			{
+				throw "t25: detach of an empty list";
+			}
+		}
+
+		if (!tr.valid())
+		{
+			throw "t25: reclaimer destructor did not drain";
+		}
+	}
+
+	template <>
+	constexpr void test<26>(opt_list opt)
+	{
+		arena a(4096);
+		{
+			using arena_list = list<int, arena_allocator<int>>;
+
+			static_assert(!is_concurrent_allocator_v<arena_allocator<int>>);
+
+			arena_list l(a);
+
+			for (int i = 0; i < 1000; ++i)
+			{
+				l.push_back(1000 - i);
+			}
+
+			l.erase(l.begin());
+			l.remove_if([](int value) { return value % 3 == 0; });
+			l.sort();
+
+			arena_list copy(l, arena_allocator<int>(a));
+			l.clear();
+
+			if (!l.empty() || copy.size() != 666 || copy.front() != 1 || copy.back() != 998)
+			{
+				throw "t26: list over arena";
+			}
+		}
+
+		a.release();
+
+		if (a.blocks() != 0 || a.bytes_reserved() != 0)
+		{
+			throw "t26: release kept blocks";
+		}
+	}
+
+	template <>
+	constexpr void test<27>(opt_list opt)
+	{
+		using relocatable = list<int, std::allocator<int>, heap_sentinel>;
+
+		static_assert(is_trivially_relocatable_v<relocatable>);
+		static_assert(!is_trivially_relocatable_v<list<int>>);
+		static_assert(is_trivially_relocatable_v<list<int, fancy_allocator<int>, heap_sentinel>>);
+
+		std::vector<relocatable> buckets;
+
+		for (int i = 0; i < 40; ++i)
+		{
+			buckets.emplace_back();
+
+			for (int j = 0; j <= i; ++j)
+			{
+				buckets.back().push_back(j);
+			}
+		}
+
+		for (int i = 0; i < 40; ++i)
+		{
+			if (buckets[i].size() != static_cast<std::size_t>(i + 1) || *std::prev(buckets[i].end()) != i)
+			{
+				throw "t27: bucket corrupted by reallocation";
+			}
+		}
+
+		const auto end = buckets[5].end();
+		relocatable moved(std::move(buckets[5]));
+
+		if (!buckets[5].empty() || moved.size() != 6 || moved.end() != end)
+		{
+			throw "t27: move did not take the sentinel";
+		}
+
+		buckets[5].push_back(7);
+		buckets[6] = std::move(moved);
+		buckets[7].swap(buckets[6]);
+		buckets[7].splice(buckets[7].begin(), buckets[8]);
+		buckets[7].sort();
+
+		if (buckets[5].front() != 7 || buckets[6].size() != 8 || buckets[7].size() != 15
+			|| buckets[7].front() != 0 || buckets[7].back() != 8 || !buckets[8].empty())
+		{
+			throw "t27: relocatable list operations";
+		}
+
+		tracker left_track;
+		tracker right_track;
+		tracker moved_track;
+
+		{
+			using isolated = list<int, isolated_tracker<int>, heap_sentinel>;
+
+			isolated left({ 1, 2, 3 }, isolated_tracker<int>{ left_track });
+			isolated right({ 4 }, isolated_tracker<int>{ right_track });
+			isolated moved({ 5, 6 }, isolated_tracker<int>{ moved_track });
+
+			left = right;
+			right = std::move(moved);
+
+			if (left != isolated({ 4 }, isolated_tracker<int>{ left_track })
+				|| right != isolated({ 5, 6 }, isolated_tracker<int>{ right_track }))
+			{
+				throw "t27: assignment across allocators";
+			}
+
+			left.push_back(9);
+			right.push_back(9);
+		}
+
+		for (const tracker& tr : { left_track, right_track, moved_track })
+		{
+			if (tr.allocations != tr.deallocations)
+			{
+				throw "t27: anchor freed by the wrong allocator";
+			}
+		}
+	}
+
+	template <>
+	constexpr void test<28>(opt_list opt)
+	{
+		struct record
+		{
+			int key;
+			std::array<int, 32> payload{};
+		};
+
+		struct xorshift
+		{
+			using result_type = std::uint32_t;
+
+			static constexpr result_type min() { return 0; }
+			static constexpr result_type max() { return 0xFFFFFFFF; }
+
+			constexpr result_type operator()() noexcept
+			{
+				state ^= state << 13;
+				state ^= state >> 17;
+				state ^= state << 5;
+				return state;
+			}
+
+			result_type state = 2463534242u;
+		};
+
+		const auto keys = [](const auto& l)
+		{
+			std::array<int, 10> out{};
+			std::ranges::transform(l, out.begin(), &record::key);
+			return out;
+		};
+
+		list<record> l;
+
+		for (int i = 0; i < 10; ++i)
+		{
+			l.push_back(record{ i });
+		}
+
+		const record* third = std::addressof(*std::ranges::next(l.begin(), 3));
+
+		const auto old_first = l.rotate(std::ranges::next(l.begin(), 3));
+
+		if (old_first != std::ranges::next(l.begin(), 7)
+			|| keys(l) != std::array{ 3, 4, 5, 6, 7, 8, 9, 0, 1, 2 } || std::addressof(l.front()) != third)
+		{
+			throw "t28: rotate";
+		}
+
+		list<record> empty;
+
+		if (l.rotate(l.begin()) != l.end() || l.rotate(l.end()) != l.begin() || l.front().key != 3
+			|| empty.rotate(empty.begin()) != empty.end())
+		{
+			throw "t28: rotate at the ends";
+		}
+
+		l.reverse(std::ranges::next(l.begin(), 2), std::ranges::next(l.begin(), 6));
+
+		if (keys(l) != std::array{ 3, 4, 8, 7, 6, 5, 9, 0, 1, 2 } || l.back().key != 2 || std::prev(l.end())->key != 2)
+		{
+			throw "t28: reverse range";
+		}
+
+		l.shuffle(xorshift{});
+
+		if (std::ranges::count_if(l, [&](const record& r) { return &r == third; }) != 1 || l.size() != 10)
+		{
+			throw "t28: shuffle";
+		}
+
+		const auto nth = l.nth_element(4, [](const record& a, const record& b) { return a.key < b.key; });
+
+		if (nth->key != 4 || !std::ranges::all_of(l.begin(), nth, [](const record& r) { return r.key < 4; }))
+		{
+			throw "t28: nth_element";
+		}
+
+		l.partial_sort(3, [](const record& a, const record& b) { return a.key > b.key; });
+
+		if (keys(l)[0] != 9 || keys(l)[1] != 8 || keys(l)[2] != 7)
+		{
+			throw "t28: partial_sort";
+		}
+	}
+
+	template <>
+	constexpr void test<29>(opt_list opt)
+	{
+		const auto hash = [](int value) { return static_cast<std::size_t>(value) * 0x9E3779B97F4A7C15ull; };
+
+		list<int> l{ 5, 3, 5, 1, 3, 3, 7, 1, 0, 0 };
+		const int* first_five = std::addressof(l.front());
+
+		if (l.unique_unordered(hash) != 5 || l != list<int>{ 5, 3, 1, 7, 0 } || l.size() != 5
+			|| std::addressof(l.front()) != first_five || std::prev(l.end()) != std::ranges::next(l.begin(), 4))
+		{
+			throw "t29: unique_unordered";
+		}
+
+		list<std::pair<int, int>> pairs{ { 1, 0 }, { 2, 1 }, { 1, 2 }, { 3, 3 }, { 2, 4 } };
+		const auto removed = pairs.unique_unordered(
+			[&](const std::pair<int, int>& p) { return hash(p.first); },
+			[](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first == b.first; });
+
+		if (removed != 2 || pairs != list<std::pair<int, int>>{ { 1, 0 }, { 2, 1 }, { 3, 3 } })
+		{
+			throw "t29: unique_unordered with key equality";
+		}
+
+		list<int> empty;
+
+		if (empty.unique_unordered(hash) != 0)
+		{
+			throw "t29: empty list";
+		}
+	}
+
+	template <>
+	constexpr void test<30>(opt_list opt)
+	{
+		const list<int> a{ 1, 2, 2, 4, 6, 8, 9 };
+		const list<int> b{ 2, 3, 4, 4, 8, 10 };
+
+		list<int> u = a;
+		list<int> donor = b;
+		const int* three = std::addressof(*std::ranges::next(donor.begin()));
+		u.set_union(donor);
+
+		if (u != list<int>{ 1, 2, 2, 3, 4, 4, 6, 8, 9, 10 } || donor != list<int>{ 2, 4, 8 }
+			|| std::addressof(*std::ranges::next(u.begin(), 3)) != three)
+		{
+			throw "t30: set_union";
+		}
+
+		list<int> i = a;
+
+		if (i.set_intersection(b) != 4 || i != list<int>{ 2, 4, 8 })
+		{
+			throw "t30: set_intersection";
+		}
+
+		list<int> d = a;
+
+		if (d.set_difference(b) != 3 || d != list<int>{ 1, 2, 6, 9 })
+		{
+			throw "t30: set_difference";
+		}
+
+		list<int> s = a;
+		s.set_symmetric_difference(list<int>(b));
+
+		if (s != list<int>{ 1, 2, 3, 4, 6, 9, 10 })
+		{
+			throw "t30: set_symmetric_difference";
+		}
+
+		list<int> desc{ 9, 5, 1 };
+		desc.set_union(list<int>{ 7, 5, 3 }, std::greater{});
+
+		if (desc != list<int>{ 9, 7, 5, 3, 1 } || desc.set_difference(desc) != 5 || !desc.empty())
+		{
+			throw "t30: set operations with a comparator";
+		}
+	}
+
+	template <>
+	constexpr void test<31>(opt_list opt)
+	{
+		timing_wheel<int> wheel;
+
+		wheel.schedule(3, 3);
+		wheel.schedule(0, 1);
+		const auto cancelled = wheel.schedule(300, -1);
+		const auto moved = wheel.schedule(70'000, 290);
+		wheel.schedule(256, 256);
+		wheel.schedule(270, 270);
+
+		wheel.cancel(cancelled);
+		wheel.reschedule(moved, 290);
+
+		if (wheel.size() != 5)
+		{
+			throw "t31: schedule and cancel";
+		}
+
+		timing_wheel<int>::timer_list expired;
+		wheel.advance(expired, 3);
+
+		if (expired.size() != 2 || expired.front().value != 1 || expired.back().deadline != 3)
+		{
+			throw "t31: expiry within the first level";
+		}
+
+		wheel.advance(expired, 252);
+
+		if (expired.size() != 2 || wheel.size() != 3)
+		{
+			throw "t31: timer expired early";
+		}
+
+		wheel.advance(expired, 35);
+
+		const std::vector<std::pair<int, std::uint64_t>> expected{ { 1, 1 }, { 3, 3 }, { 256, 256 }, { 270, 270 }, { 290, 290 } };
+		std::vector<std::pair<int, std::uint64_t>> fired;
+
+		for (const auto& timer : expired)
+		{
+			fired.emplace_back(timer.value, timer.deadline);
+		}
+
+		if (fired != expected || wheel.now() != 290 || !wheel.empty())
+		{
+			throw "t31: expiry order across a cascade";
+		}
+
+		expired.clear();
+
+		wheel.schedule(2, 7);
+		wheel.schedule(2, 8);
+		wheel.advance(expired, 2);
+
+		if (expired.size() != 2 || expired.front().value != 7 || expired.back().deadline != 292 || !wheel.empty())
+		{
+			throw "t31: batch expiry";
+		}
+	}
+
+	template <>
+	constexpr void test<32>(opt_list opt)
+	{
+		list<int> values;
+		auto finger = values.end();
+
+		for (const int value : { 5, 6, 8, 7, 9, 1, 9, 10 })
+		{
+			finger = values.insert_sorted(finger, value);
+		}
+
+		if (values != list<int>{ 1, 5, 6, 7, 8, 9, 9, 10 } || *finger != 10)
+		{
+			throw "t32: insert_sorted with a finger";
+		}
+
+		values.insert_sorted(4);
+		values.emplace_sorted(11);
+		values.emplace_sorted_hint(values.begin(), 3);
+
+		const std::array<int, 5> batch{ 12, 0, 7, 2, 12 };
+		values.insert_sorted_range(batch);
+
+		if (values != list<int>{ 0, 1, 2, 3, 4, 5, 6, 7, 7, 8, 9, 9, 10, 11, 12, 12 })
+		{
+			throw "t32: emplace_sorted and insert_sorted_range";
+		}
+
+		list<std::pair<int, int>> stable;
+		const auto by_key = [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; };
+
+		stable.insert_sorted({ 1, 0 }, by_key);
+		stable.insert_sorted({ 3, 0 }, by_key);
+		stable.insert_sorted(stable.begin(), { 1, 1 }, by_key);
+		stable.insert_sorted(stable.begin(), { 2, 0 }, by_key);
+
+		if (stable != list<std::pair<int, int>>{ { 3, 0 }, { 2, 0 }, { 1, 0 }, { 1, 1 } })
+		{
+			throw "t32: insert_sorted is stable";
+		}
+
+		stable.emplace_sorted(by_key, 2, 1);
+		stable.emplace_sorted_hint(stable.begin(), by_key, 0, 0);
+		stable.emplace_sorted_hint(std::ranges::prev(stable.end()), by_key, 4, 0);
+
+		if (stable != list<std::pair<int, int>>{ { 4, 0 }, { 3, 0 }, { 2, 0 }, { 2, 1 }, { 1, 0 }, { 1, 1 }, { 0, 0 } })
+		{
+			throw "t32: emplace_sorted with a comparator";
+		}
+	}
+
+	template <>
+	constexpr void test<33>(opt_list opt)
+	{
+		struct record
+		{
+			int id;
+			std::array<int, 32> payload;
+
+			constexpr bool operator==(const record&) const = default;
+		};
+
+		struct by_id
+		{
+			constexpr int operator()(const record& value) const noexcept
+			{
+				return value.id;
+			}
+		};
+
+		using records = hot_cold_list<record, by_id>;
+		records values;
+
+		static_assert(std::same_as<decltype(values.emplace_back(0, std::array<int, 32>{})), const record&>);
+
+		for (const int id : { 4, 2, 7, 2, 9, 4 })
+		{
+			values.emplace_back(id, std::array<int, 32>{ id * 10 });
+		}
+
+		values.sort();
+
+		if (values.unique() != 2 || values.size() != 4 || values.front().payload[0] != 20
+			|| !std::ranges::equal(values, std::array{ 2, 4, 7, 9 }, {}, by_id{}))
+		{
+			throw "t33: sort and unique on the hot key";
+		}
+
+		records others{ { 1, {} }, { 8, {} } };
+		records copy = others;
+		values.merge(others);
+
+		if (values.size() != 6 || !others.empty() || copy.size() != 2
+			|| !std::ranges::equal(values, std::array{ 1, 2, 4, 7, 8, 9 }, {}, by_id{}))
+		{
+			throw "t33: merge";
+		}
+
+		values.modify(values.begin(), [](record& value) { value.id = 10; });
+		values.erase(std::ranges::next(values.begin()));
+		values.sort(std::greater{});
+
+		if (values.begin().key() != 10 || values.back().id != 4 || values.size() != 5)
+		{
+			throw "t33: modify refreshes the key";
+		}
+
+		values = copy;
+
+		if (values != copy)
+		{
+			throw "t33: copy assignment";
+		}
+	}
+
+	template <>
+	constexpr void test<34>(opt_list opt)
+	{
+		const list<std::uint64_t> values{ 1, 2, 3, 4, 5 };
+		const node_layout layout = values.layout_stats();
+
+		if (layout.nodes != 5 || layout.node_bytes < sizeof(std::uint64_t) + 2 * sizeof(void*)
+			|| layout.overhead_bytes != 5 * (layout.node_bytes - sizeof(std::uint64_t)))
+		{
+			throw "t34: layout_stats node accounting";
+		}
+
+	}
+
+	template <>
+	constexpr void test<35>(opt_list opt)
+	{
+		tracker track;
+
+		{
+			using tracked = forward_list<int, allocator_tracker<int>>;
+			tracked values({ 5, 3, 8, 1 }, allocator_tracker<int>{ track });
+
+			values.push_front(9);
+			values.insert_after(values.begin(), { 7, 7 });
+			values.emplace_after(values.before_begin(), 0);
+
+			if (values != tracked({ 0, 9, 7, 7, 5, 3, 8, 1 }, allocator_tracker<int>{ track }))
+			{
+				throw "t35: insert_after and emplace_after";
+			}
+
+			values.sort();
+
+			if (values.unique() != 1 || values != tracked({ 0, 1, 3, 5, 7, 8, 9 }, allocator_tracker<int>{ track }))
+			{
+				throw "t35: sort and unique";
+			}
+
+			tracked odd({ 2, 4, 10 }, allocator_tracker<int>{ track });
+			values.merge(odd);
+			values.remove(values.front());
+			values.remove_if([](int value) { return value > 8; });
+
+			if (!odd.empty() || values != tracked({ 1, 2, 3, 4, 5, 7, 8 }, allocator_tracker<int>{ track }))
+			{
+				throw "t35: merge and remove_if";
+			}
+
+			tracked moved(allocator_tracker<int>{ track });
+			moved.splice_after(moved.before_begin(), values, values.begin(), std::ranges::next(values.begin(), 4));
+			moved.splice_after(moved.before_begin(), values, values.before_begin());
+			values.reverse();
+			values.erase_after(values.begin());
+			values.resize(4, -1);
+
+			if (moved != tracked({ 1, 2, 3, 4 }, allocator_tracker<int>{ track })
+				|| values != tracked({ 8, 5, -1, -1 }, allocator_tracker<int>{ track }))
+			{
+				throw "t35: splice_after, reverse and resize";
+			}
+
+			values = moved;
+			moved.assign(2, 6);
+			values.swap(moved);
+
+			if (values != tracked({ 6, 6 }, allocator_tracker<int>{ track }) || !(moved < values)
+				|| std::ranges::distance(moved) != 4)
+			{
+				throw "t35: assignment and swap";
+			}
+
+			tracked stable(allocator_tracker<int>{ track });
+			stable.assign_range(std::array{ 21, 11, 20, 10, 22, 12 });
+			stable.sort([](int lhs, int rhs) { return lhs / 10 < rhs / 10; });
+
+			if (stable != tracked({ 11, 10, 12, 21, 20, 22 }, allocator_tracker<int>{ track }))
+			{
+				throw "t35: sort is stable";
+			}
+		}
+
+		if (!track.valid())
+		{
+			throw "t35: allocations leaked";
+		}
+	}
+
 	constexpr bool all_tests_passed()
 	{
 		[]<std::size_t ... I>(std::index_sequence<I...>)
@@ -0,0 +1,414 @@
+#ifndef CONSTEXPR_LIST_THREAD_AWARE_ALLOCATOR
+#define CONSTEXPR_LIST_THREAD_AWARE_ALLOCATOR
+
+#include <array>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <span>
+#include <thread>
+
+#include "constexpr_list.hpp"
+
+namespace constexpr_list
+{
+	struct thread_aware_stats
+	{
+		std::size_t allocations = 0;
+		std::size_t local_frees = 0;
+		std::size_t remote_frees = 0;
+		std::size_t batches_sent = 0;
+		std::size_t batches_received = 0;
+	};
+
+	class thread_aware_pool
+	{
+	public:
+		static constexpr std::size_t slab_size = std::size_t{ 1 } << 16;
+		static constexpr std::size_t default_batch_size = 64;
+
+		explicit thread_aware_pool(std::size_t batch_size = default_batch_size) noexcept
+			: batch_size_{ std::max<std::size_t>(batch_size, 1) }
+		{}
+
+		thread_aware_pool(const thread_aware_pool&) = delete;
+		thread_aware_pool& operator=(const thread_aware_pool&) = delete;
+
+		~thread_aware_pool()
+		{
+			for (cache_* cache = caches_; cache;)
+			{
+				cache_* next = cache->next_;
+
+				for (slab_* slab = cache->slabs_; slab;)
+				{
+					slab_* next_slab = slab->next_;
+					::operator delete(static_cast<void*>(slab), slab_size, std::align_val_t{ slab_size });
+					slab = next_slab;
+				}
+
+				delete cache;
+				cache = next;
+			}
+		}
+
+		void* allocate(std::size_t bytes, std::size_t alignment)
+		{
+			if (!this->pooled_(bytes, alignment))
+			{
+				return ::operator new(bytes, std::align_val_t{ alignment });
+			}
+
+			cache_* local = this->local_cache_();
+
+			if (!local)
+			{
+				throw std::bad_alloc{};
+			}
+
+			cache_& cache = *local;
+			cache.allocations_.fetch_add(1, std::memory_order_relaxed);
+
+			if (!cache.free_)
+			{
+				cache.free_ = cache.inbox_.exchange(nullptr, std::memory_order_acquire);
+			}
+
+			if (free_block_* block = cache.free_)
+			{
+				cache.free_ = block->next_;
+				return block;
+			}
+
+			return this->carve_(cache);
+		}
+
+		void deallocate(void* ptr, std::size_t bytes, std::size_t alignment) noexcept
+		{
+			if (!this->pooled_(bytes, alignment))
+			{
+				::operator delete(ptr, bytes, std::align_val_t{ alignment });
+				return;
+			}
+
+			cache_* local = this->local_cache_();
+			cache_* owner = slab_of_(ptr)->owner_;
+			free_block_* block = ::new (ptr) free_block_{ nullptr };
+
+			if (owner == local)
+			{
+				block->next_ = local->free_;
+				local->free_ = block;
+				local->local_frees_.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			outbox_* target = local ? local->outbox_for_(owner) : nullptr;
+
+			if (!target)
+			{
+				push_inbox_(owner, block, block);
+				(local ? local : owner)->remote_frees_.fetch_add(1, std::memory_order_relaxed);
+				owner->batches_received_.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			cache_& cache = *local;
+			outbox_& outbox = *target;
+			cache.remote_frees_.fetch_add(1, std::memory_order_relaxed);
+			block->next_ = outbox.head_;
+			outbox.head_ = block;
+
+			if (!outbox.tail_)
+			{
+				outbox.tail_ = block;
+			}
+
+			if (++outbox.count_ == batch_size_)
+			{
+				this->send_(cache, outbox);
+			}
+		}
+
+		void flush() noexcept
+		{
+			cache_* cache = this->local_cache_();
+
+			if (!cache)
+			{
+				return;
+			}
+
+			for (outbox_& outbox : std::span{ cache->outboxes_ }.first(cache->outbox_count_))
+			{
+				if (outbox.count_ != 0)
+				{
+					this->send_(*cache, outbox);
+				}
+			}
+		}
+
+		[[nodiscard]]
+		thread_aware_stats stats() const
+		{
+			thread_aware_stats total;
+			std::scoped_lock lock{ mutex_ };
+
+			for (const cache_* cache = caches_; cache; cache = cache->next_)
+			{
+				total.allocations += cache->allocations_.load(std::memory_order_relaxed);
+				total.local_frees += cache->local_frees_.load(std::memory_order_relaxed);
+				total.remote_frees += cache->remote_frees_.load(std::memory_order_relaxed);
+				total.batches_sent += cache->batches_sent_.load(std::memory_order_relaxed);
+				total.batches_received += cache->batches_received_.load(std::memory_order_relaxed);
+			}
+
+			return total;
+		}
+
+		[[nodiscard]]
+		std::size_t batch_size() const noexcept
+		{
+			return batch_size_;
+		}
+
+	private:
+		struct cache_;
+
+		struct free_block_
+		{
+			free_block_* next_;
+		};
+
+		struct slab_
+		{
+			cache_* owner_;
+			slab_* next_;
+		};
+
+		struct outbox_
+		{
+			cache_* owner_ = nullptr;
+			free_block_* head_ = nullptr;
+			free_block_* tail_ = nullptr;
+			std::size_t count_ = 0;
+		};
+
+		struct cache_
+		{
+			static constexpr std::size_t max_outboxes = 16;
+
+			outbox_* outbox_for_(cache_* owner) noexcept
+			{
+				for (outbox_& outbox : std::span{ outboxes_ }.first(outbox_count_))
+				{
+					if (outbox.owner_ == owner)
+					{
+						return &outbox;
+					}
+				}
+
+				if (outbox_count_ == max_outboxes)
+				{
+					return nullptr;
+				}
+
+				outbox_& outbox = outboxes_[outbox_count_++];
+				outbox.owner_ = owner;
+				return &outbox;
+			}
+
+			std::thread::id thread_{};
+			cache_* next_ = nullptr;
+			free_block_* free_ = nullptr;
+			std::atomic<free_block_*> inbox_ = nullptr;
+			slab_* slabs_ = nullptr;
+			std::uintptr_t cursor_ = 0;
+			std::uintptr_t limit_ = 0;
+			std::array<outbox_, max_outboxes> outboxes_{};
+			std::size_t outbox_count_ = 0;
+			std::atomic<std::size_t> allocations_ = 0;
+			std::atomic<std::size_t> local_frees_ = 0;
+			std::atomic<std::size_t> remote_frees_ = 0;
+			std::atomic<std::size_t> batches_sent_ = 0;
+			std::atomic<std::size_t> batches_received_ = 0;
+		};
+
+		struct memo_
+		{
+			std::uint64_t pool_ = 0;
+			cache_* entry_ = nullptr;
+		};
+
+		static slab_* slab_of_(void* ptr) noexcept
+		{
+			return reinterpret_cast<slab_*>(reinterpret_cast<std::uintptr_t>(ptr) & ~(slab_size - 1));
+		}
+
+		static std::uint64_t next_id_() noexcept
+		{
+			static std::atomic<std::uint64_t> counter = 0;
+			return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+
+		bool pooled_(std::size_t bytes, std::size_t alignment) noexcept
+		{
+			if (bytes < sizeof(free_block_) || bytes > slab_size / 8 || alignment > alignof(std::max_align_t))
+			{
+				return false;
+			}
+
+			const std::size_t size = (bytes + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+			std::size_t expected = 0;
+
+			return block_size_.compare_exchange_strong(expected, size, std::memory_order_relaxed) || expected == size;
+		}
+
+		cache_* local_cache_() noexcept
+		{
+			thread_local memo_ memo;
+
+			if (memo.pool_ == id_)
+			{
+				return memo.entry_;
+			}
+
+			std::scoped_lock lock{ mutex_ };
+			cache_* cache = caches_;
+
+			while (cache && cache->thread_ != std::this_thread::get_id())
+			{
+				cache = cache->next_;
+			}
+
+			if (!cache)
+			{
+				cache = new (std::nothrow) cache_{ .thread_ = std::this_thread::get_id(), .next_ = caches_ };
+
+				if (!cache)
+				{
+					return nullptr;
+				}
+
+				caches_ = cache;
+			}
+
+			memo = { id_, cache };
+			return cache;
+		}
+
+		void* carve_(cache_& cache)
+		{
+			const std::size_t size = block_size_.load(std::memory_order_relaxed);
+
+			if (cache.cursor_ + size > cache.limit_)
+			{
+				void* memory = ::operator new(slab_size, std::align_val_t{ slab_size });
+				cache.slabs_ = ::new (memory) slab_{ &cache, cache.slabs_ };
+				cache.cursor_ = reinterpret_cast<std::uintptr_t>(memory) + ((sizeof(slab_) + size - 1) / size) * size;
+				cache.limit_ = reinterpret_cast<std::uintptr_t>(memory) + slab_size;
+			}
+
+			void* block = reinterpret_cast<void*>(cache.cursor_);
+			cache.cursor_ += size;
+			return block;
+		}
+
+		static void push_inbox_(cache_* owner, free_block_* first, free_block_* last) noexcept
+		{
+			free_block_* head = owner->inbox_.load(std::memory_order_relaxed);
+
+			do
+			{
+				last->next_ = head;
+			}
+			while (!owner->inbox_.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		void send_(cache_& cache, outbox_& outbox) noexcept
+		{
+			push_inbox_(outbox.owner_, outbox.head_, outbox.tail_);
+			outbox.head_ = nullptr;
+			outbox.tail_ = nullptr;
+			outbox.count_ = 0;
+			cache.batches_sent_.fetch_add(1, std::memory_order_relaxed);
+			outbox.owner_->batches_received_.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		const std::size_t batch_size_;
+		const std::uint64_t id_ = next_id_();
+		std::atomic<std::size_t> block_size_ = 0;
+		mutable std::mutex mutex_;
+		cache_* caches_ = nullptr;
+	};
+
+	template <typename T>
+	class thread_aware_allocator
+	{
+		template <typename U>
+		friend class thread_aware_allocator;
+
+	public:
+		using value_type = T;
+		using is_always_equal = std::false_type;
+
+		constexpr thread_aware_allocator(thread_aware_pool& pool) noexcept
+			: pool_{ std::addressof(pool) }
+		{}
+
+		template <typename U>
+		constexpr thread_aware_allocator(const thread_aware_allocator<U>& other) noexcept
+			: pool_{ other.pool_ }
+		{}
+
+		constexpr T* allocate(std::size_t n)
+		{
+			if consteval
+			{
+				return std::allocator<T>{}.allocate(n);
+			}
+			else
+			{
+				if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+				{
+					throw std::bad_array_new_length{};
+				}
+
+				return static_cast<T*>(pool_->allocate(n * sizeof(T), alignof(T)));
+			}
+		}
+
+		constexpr void deallocate(T* ptr, std::size_t n) noexcept
+		{
+			if consteval
+			{
+				std::allocator<T>{}.deallocate(ptr, n);
+			}
+			else
+			{
+				pool_->deallocate(ptr, n * sizeof(T), alignof(T));
+			}
+		}
+
+		constexpr thread_aware_pool& resource() const noexcept
+		{
+			return *pool_;
+		}
+
+		template <typename U>
+		friend constexpr bool operator==(const thread_aware_allocator& lhs, const thread_aware_allocator<U>& rhs) noexcept
+		{
+			return lhs.pool_ == rhs.pool_;
+		}
+
+	private:
+		thread_aware_pool* pool_;
+	};
+
+	template <typename T>
+	struct is_concurrent_allocator<thread_aware_allocator<T>> : std::true_type
+	{};
+}
+
+#endif // CONSTEXPR_LIST_THREAD_AWARE_ALLOCATOR
@@ -0,0 +1,180 @@
+#ifndef CONSTEXPR_LIST_TIMING_WHEEL
+#define CONSTEXPR_LIST_TIMING_WHEEL
+
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#include "constexpr_list.hpp"
+
+namespace constexpr_list
+{
+	template <typename T, typename Allocator = std::allocator<T>>
+	class timing_wheel
+	{
+	public:
+		using value_type = T;
+		using tick_type = std::uint64_t;
+		using size_type = std::size_t;
+		using allocator_type = Allocator;
+
+		struct timer
+		{
+			T value;
+			tick_type deadline;
+		};
+
+		using timer_allocator = typename
+			std::allocator_traits<Allocator>::template rebind_alloc<timer>;
+		using timer_list = list<timer, timer_allocator>;
+		using handle = typename timer_list::iterator;
+
+		static constexpr size_type slot_bits = 8;
+		static constexpr size_type slots = size_type{ 1 } << slot_bits;
+		static constexpr size_type levels = 4;
+
+	private:
+		using bucket_allocator = typename
+			std::allocator_traits<Allocator>::template rebind_alloc<timer_list>;
+
+		static constexpr size_type overflow_ = levels * slots;
+		static constexpr tick_type mask_ = slots - 1;
+
+	public:
+		explicit constexpr timing_wheel(const Allocator& alloc = Allocator())
+			: buckets_(bucket_allocator(alloc))
+		{
+			buckets_.reserve(overflow_ + 1);
+
+			for (size_type i = 0; i <= overflow_; ++i)
+			{
+				buckets_.emplace_back(timer_allocator(alloc));
+			}
+		}
+
+		template <typename ... Args>
+		constexpr handle schedule(tick_type delay, Args&& ... args)
+		{
+			const tick_type deadline = now_ + std::max<tick_type>(delay, 1);
+			timer_list& bucket = buckets_[this->bucket_of_(deadline)];
+
+			bucket.emplace_back(T(std::forward<Args>(args)...), deadline);
+			++size_;
+
+			return std::ranges::prev(bucket.end());
+		}
+
+		// reschedule() and cancel() require a pending timer. Once a timer has
+		// expired, its handle refers to a node in the list given to advance().
+		constexpr void reschedule(handle timer, tick_type delay)
+		{
+			const tick_type deadline = now_ + std::max<tick_type>(delay, 1);
+			timer_list& from = buckets_[this->bucket_of_(timer->deadline)];
+			timer_list& to = buckets_[this->bucket_of_(deadline)];
+
+			timer->deadline = deadline;
+			to.splice(to.end(), from, timer);
+		}
+
+		constexpr void cancel(handle timer)
+		{
+			buckets_[this->bucket_of_(timer->deadline)].erase(timer);
+			--size_;
+		}
+
+		constexpr void advance(timer_list& expired, tick_type ticks = 1)
+		{
+			for (; ticks != 0; --ticks)
+			{
+				++now_;
+
+				if ((now_ & mask_) == 0)
+				{
+					const size_type top = std::min<size_type>(std::countr_zero(now_) / slot_bits, levels);
+
+					for (size_type level = top; level != 0; --level)
+					{
+						this->cascade_(level == levels
+							? overflow_
+							: level * slots + ((now_ >> (level * slot_bits)) & mask_));
+					}
+				}
+
+				timer_list& bucket = buckets_[now_ & mask_];
+				size_ -= bucket.size();
+				expired.splice(expired.end(), bucket);
+			}
+		}
+
+		constexpr timer_list advance(tick_type ticks = 1)
+		{
+			timer_list expired(buckets_.front().get_allocator());
+			this->advance(expired, ticks);
+			return expired;
+		}
+
+		constexpr void clear()
+		{
+			for (timer_list& bucket : buckets_)
+			{
+				bucket.clear();
+			}
+
+			size_ = 0;
+		}
+
+		[[nodiscard]]
+		constexpr tick_type now() const noexcept
+		{
+			return now_;
+		}
+
+		[[nodiscard]]
+		constexpr size_type size() const noexcept
+		{
+			return size_;
+		}
+
+		[[nodiscard]]
+		constexpr bool empty() const noexcept
+		{
+			return size_ == 0;
+		}
+
+		constexpr allocator_type get_allocator() const noexcept
+		{
+			return static_cast<allocator_type>(buckets_.front().get_allocator());
+		}
+
+	private:
+		constexpr size_type bucket_of_(tick_type deadline) const noexcept
+		{
+			const size_type level = static_cast<size_type>(std::max<tick_type>(std::bit_width(deadline ^ now_), 1) - 1) / slot_bits;
+
+			if (level >= levels)
+			{
+				return overflow_;
+			}
+
+			return level * slots + ((deadline >> (level * slot_bits)) & mask_);
+		}
+
+		constexpr void cascade_(size_type index)
+		{
+			timer_list pending(buckets_[index].get_allocator());
+			pending.splice(pending.end(), buckets_[index]);
+
+			while (!pending.empty())
+			{
+				timer_list& bucket = buckets_[this->bucket_of_(pending.front().deadline)];
+				bucket.splice(bucket.end(), pending, pending.begin());
+			}
+		}
+
+		std::vector<timer_list, bucket_allocator> buckets_;
+		tick_type now_ = 0;
+		size_type size_ = 0;
+	};
+}
+
+#endif // CONSTEXPR_LIST_TIMING_WHEEL